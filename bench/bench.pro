@@ -0,0 +1,16 @@
+QT = core gui
+CONFIG += console
+CONFIG -= app_bundle
+TARGET = rtsys-mission-bench
+
+# Core
+include(../core/core.pri)
+
+# Model
+HEADERS += ../private/model.h ../private/backend.h ../private/model_misc.h ../private/pool.h
+SOURCES += ../private/model.cpp ../private/backend.cpp
+
+# Main
+HEADERS += ../manager.h
+SOURCES += ../manager.cpp main.cpp
+RESOURCES += ../resource.qrc
@@ -0,0 +1,406 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/diff.h"
+#include "core/generator.h"
+#include "manager.h"
+#include "private/model.h"
+#include "protobuf/mission.pb.h"
+
+#include <QCommandLineParser>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QFile>
+#include <QGuiApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPair>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The shapes of the synthetic missions, the names below are in the same order.
+//  - Flat: top-level points, rails and segments only.
+//  - Routes: collections of points.
+//  - Families: collections of rails.
+//  - Scenarios: collections mixing points, rails and segments.
+enum Shape { kFlat, kRoutes, kFamilies, kScenarios, kNoShape };
+
+const char *const ShapeNames[] = {"flat", "routes", "families", "scenarios"};
+
+// The options of a benchmark run, as given on the command line.
+struct Options {
+    Shape shape;
+    int components;
+    int elements;
+    int edits;
+    int repeat;
+    quint64 seed;
+};
+
+// The timings of one benchmark: the duration of each run and the number of
+// operations a run does. The pool allocations are those of the last run.
+struct Benchmark {
+    QString name;
+    qint64 operations = 0;
+    QVector<qint64> nsecs;
+    qint64 allocations = 0;
+};
+
+// The results of the reads of the benchmarks, kept so that the reads aren't
+// optimized away.
+static volatile qint64 Sink = 0;
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns the generator options of the given shape.
+static mission::GeneratorOptions generatorOptions(const Options &options)
+{
+    mission::GeneratorOptions generator;
+    generator.components = options.components;
+    generator.elements = options.elements;
+    generator.collection_percent = options.shape == kFlat ? 0 : 100;
+    generator.point_weight = options.shape == kFamilies ? 0 : 1;
+    generator.rail_weight = options.shape == kRoutes ? 0 : 1;
+    generator.segment_weight = options.shape == kRoutes || options.shape == kFamilies ? 0 : 1;
+    generator.seed = options.seed;
+    return generator;
+}
+
+// Loads the given mission into the manager and waits for the loading to be
+// finished. The manager takes the mission over.
+static void loadMission(MissionManager *manager, std::unique_ptr<pb::mission::Mission> mission)
+{
+    QEventLoop loop;
+    QObject::connect(manager, &MissionManager::loadFinished, &loop, &QEventLoop::quit);
+    manager->loadMission(std::move(mission));
+    if (manager->isLoading()) loop.exec();
+}
+
+// Fetches every item of the model, returns the indexes of the items below the
+// mission, in depth-first order.
+static QVector<QModelIndex> fetchAll(MissionModel *model)
+{
+    QVector<QModelIndex> indexes;
+    std::function<void(const QModelIndex &)> fetch = [&](const QModelIndex &parent) {
+        while (model->canFetchMore(parent)) {
+            model->fetchMore(parent);
+        }
+        for (int row = 0; row < model->rowCount(parent); row++) {
+            const auto &index = model->index(row, 0, parent);
+            indexes.append(index);
+            fetch(index);
+        }
+    };
+    fetch(model->index(0, 0));
+    return indexes;
+}
+
+// Returns a copy of the given mission with the given number of edits, spread
+// over its components: the first element of a collection is removed, a
+// top-level element is replaced by a point.
+static pb::mission::Mission editedMission(const pb::mission::Mission &mission, int edits)
+{
+    auto edited = mission;
+    const auto &count = edited.components_size();
+    for (int i = qMin(edits, count) - 1; i >= 0; i--) {
+        auto *component = edited.mutable_components(static_cast<int>(static_cast<qint64>(i) * count / edits));
+        if (component->has_collection()) {
+            auto *elements = component->mutable_collection()->mutable_elements();
+            if (!elements->empty()) elements->DeleteSubrange(0, 1);
+        } else {
+            component->mutable_element()->mutable_point()->set_name("edited");
+        }
+    }
+    return edited;
+}
+
+// Runs the given benchmark the given number of times. The setup runs before
+// each run and isn't timed, the run returns its number of operations.
+static Benchmark measure(const QString &name, MissionModel *model, int repeat, const std::function<void()> &setup,
+                         const std::function<qint64()> &run)
+{
+    Benchmark benchmark;
+    benchmark.name = name;
+    for (int i = 0; i < repeat; i++) {
+        if (setup) setup();
+
+        const auto &allocations = model->pool().allocationCount();
+        QElapsedTimer timer;
+        timer.start();
+        benchmark.operations = run();
+        benchmark.nsecs.append(timer.nsecsElapsed());
+        benchmark.allocations = model->pool().allocationCount() - allocations;
+    }
+    return benchmark;
+}
+
+// Returns the given benchmark as a JSON object: the best and the mean duration
+// of a run, and the best duration per operation.
+static QJsonObject toJson(const Benchmark &benchmark)
+{
+    const auto best = qMax<qint64>(*std::min_element(benchmark.nsecs.cbegin(), benchmark.nsecs.cend()), 1);
+    qint64 total = 0;
+    for (const auto &nsecs : benchmark.nsecs) {
+        total += nsecs;
+    }
+
+    QJsonObject object;
+    object["name"] = benchmark.name;
+    object["operations"] = benchmark.operations;
+    object["runs"] = benchmark.nsecs.count();
+    object["best_ms"] = best / 1e6;
+    object["mean_ms"] = total / benchmark.nsecs.count() / 1e6;
+    object["ns_per_op"] = static_cast<double>(best) / qMax<qint64>(benchmark.operations, 1);
+    object["ops_per_s"] = benchmark.operations / (best / 1e9);
+    object["pool_allocations"] = benchmark.allocations;
+    return object;
+}
+
+// ===
+// === Main
+// ============================================================================ //
+
+int main(int argc, char *argv[])
+{
+    // The icons need a gui application, not a display.
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) qputenv("QT_QPA_PLATFORM", "offscreen");
+    QGuiApplication app(argc, argv);
+    QGuiApplication::setApplicationName("rtsys-mission-bench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Times the hot paths of the mission model on a synthetic mission, the results "
+                                     "are given as JSON.");
+    parser.addHelpOption();
+    const QCommandLineOption shape_option("shape", "flat, routes, families or scenarios, scenarios by default.",
+                                          "shape", "scenarios");
+    const QCommandLineOption components_option("components", "The number of components, 100 by default.", "count",
+                                               "100");
+    const QCommandLineOption elements_option("elements", "The number of elements per collection, 1000 by default.",
+                                             "count", "1000");
+    const QCommandLineOption edits_option("edits", "The number of additions and removals, 1000 by default.",
+                                          "count", "1000");
+    const QCommandLineOption repeat_option("repeat", "The number of runs of each benchmark, 5 by default.", "count",
+                                           "5");
+    const QCommandLineOption seed_option("seed", "The seed of the mission, 0 by default.", "seed", "0");
+    const QCommandLineOption output_option({"o", "output"}, "The JSON file, the standard output by default.",
+                                           "path");
+    parser.addOption(shape_option);
+    parser.addOption(components_option);
+    parser.addOption(elements_option);
+    parser.addOption(edits_option);
+    parser.addOption(repeat_option);
+    parser.addOption(seed_option);
+    parser.addOption(output_option);
+    parser.process(app);
+
+    Options options;
+    options.shape = kNoShape;
+    for (int i = 0; i < kNoShape; i++) {
+        if (parser.value(shape_option) == ShapeNames[i]) options.shape = static_cast<Shape>(i);
+    }
+    if (options.shape == kNoShape) parser.showHelp(1);
+    options.components = qMax(parser.value(components_option).toInt(), 1);
+    options.elements = qMax(parser.value(elements_option).toInt(), 1);
+    options.edits = qMax(parser.value(edits_option).toInt(), 1);
+    options.repeat = qMax(parser.value(repeat_option).toInt(), 1);
+    options.seed = parser.value(seed_option).toULongLong();
+
+    pb::mission::Mission mission;
+    mission::generate(generatorOptions(options), &mission);
+
+    MissionManager manager;
+    auto *model = manager.model();
+    const auto &reload = [&]() {
+        loadMission(&manager, std::make_unique<pb::mission::Mission>(mission));
+        fetchAll(model);
+    };
+
+    // The copy handed over to the manager is made by the setup, untimed.
+    QVector<Benchmark> benchmarks;
+    std::unique_ptr<pb::mission::Mission> source;
+    const auto &copy = [&]() { source = std::make_unique<pb::mission::Mission>(mission); };
+    benchmarks.append(measure("manager.loadMission", model, options.repeat, copy, [&]() {
+        loadMission(&manager, std::move(source));
+        return static_cast<qint64>(options.components);
+    }));
+    QVector<QModelIndex> indexes;
+    benchmarks.append(measure("model.fetchMore", model, options.repeat,
+                              [&]() { loadMission(&manager, std::make_unique<pb::mission::Mission>(mission)); },
+                              [&]() {
+                                  indexes = fetchAll(model);
+                                  return static_cast<qint64>(indexes.count());
+                              }));
+    const auto &items = static_cast<qint64>(indexes.count());
+
+    // The reads run on the mission fully fetched by the last run above.
+
+    QVector<QPair<QModelIndex, int>> parents = {{model->index(0, 0), model->rowCount(model->index(0, 0))}};
+    for (const auto &index : indexes) {
+        if (model->rowCount(index)) parents.append({index, model->rowCount(index)});
+    }
+    benchmarks.append(measure("model.index", model, options.repeat, nullptr, [&]() {
+        qint64 count = 0;
+        for (const auto &parent : parents) {
+            for (int row = 0; row < parent.second; row++) {
+                count += model->index(row, 0, parent.first).isValid();
+            }
+        }
+        return count;
+    }));
+    benchmarks.append(measure("model.parent", model, options.repeat, nullptr, [&]() {
+        qint64 count = 0;
+        for (const auto &index : indexes) {
+            count += model->parent(index).isValid();
+        }
+        Sink = Sink + count;
+        return items;
+    }));
+    benchmarks.append(measure("model.rowCount", model, options.repeat, nullptr, [&]() {
+        qint64 count = 0;
+        for (const auto &index : indexes) {
+            count += model->rowCount(index);
+        }
+        Sink = Sink + count;
+        return items;
+    }));
+    benchmarks.append(measure("model.data.display", model, options.repeat, nullptr, [&]() {
+        qint64 count = 0;
+        for (const auto &index : indexes) {
+            count += model->data(index, Qt::DisplayRole).isValid();
+            count += model->data(index.sibling(index.row(), MissionItem::kNameColumn), Qt::DisplayRole).isValid();
+        }
+        Sink = Sink + count;
+        return 2 * items;
+    }));
+    benchmarks.append(measure("model.data.decoration", model, options.repeat, nullptr, [&]() {
+        qint64 count = 0;
+        for (const auto &index : indexes) {
+            count += model->data(index, Qt::DecorationRole).isValid();
+        }
+        Sink = Sink + count;
+        return items;
+    }));
+    benchmarks.append(measure("backend.componentType", model, options.repeat, nullptr, [&]() {
+        qint64 count = 0;
+        for (const auto &index : indexes) {
+            count += model->item(index)->backend().componentType();
+        }
+        Sink = Sink + count;
+        return items;
+    }));
+    benchmarks.append(measure("backend.maskEnableAction", model, options.repeat, nullptr, [&]() {
+        qint64 count = 0;
+        for (const auto &index : indexes) {
+            count += model->item(index)->backend().maskEnableAction();
+        }
+        Sink = Sink + count;
+        return items;
+    }));
+
+    // The mutations run on a fresh mission each time. The additions go to the
+    // first collection of the mission, or to the mission itself when flat.
+    const auto &target = [&]() {
+        const auto &mission_index = model->index(0, 0);
+        return options.shape == kFlat ? mission_index : model->index(0, 0, mission_index);
+    };
+    benchmarks.append(measure("manager.addPoint", model, options.repeat, reload, [&]() {
+        const auto &parent = target();
+        for (int i = 0; i < options.edits; i++) {
+            manager.addPoint(parent);
+        }
+        return static_cast<qint64>(options.edits);
+    }));
+    benchmarks.append(measure("manager.addRail", model, options.repeat, reload, [&]() {
+        const auto &parent = target();
+        for (int i = 0; i < options.edits; i++) {
+            manager.addRail(parent);
+        }
+        return static_cast<qint64>(options.edits);
+    }));
+    benchmarks.append(measure("manager.remove", model, options.repeat, reload, [&]() {
+        const auto &parent = target();
+        const auto count = qMin(options.edits, model->rowCount(parent));
+        for (int i = 0; i < count; i++) {
+            manager.remove(model->index(model->rowCount(parent) / 2, 0, parent));
+        }
+        return static_cast<qint64>(count);
+    }));
+    benchmarks.append(measure("manager.remove.selection", model, options.repeat, reload, [&]() {
+        // Every other row of the parent, so that the rows make as many ranges.
+        const auto &parent = target();
+        QModelIndexList selection;
+        for (int row = 0; row < model->rowCount(parent) && selection.count() < options.edits; row += 2) {
+            selection.append(model->index(row, 0, parent));
+        }
+        manager.remove(selection);
+        return static_cast<qint64>(selection.count());
+    }));
+    auto undone = 0;
+    benchmarks.append(measure("manager.undo.remove", model, options.repeat,
+                              [&]() {
+                                  // Contiguous rows of the parent, they are
+                                  // removed then inserted back as one range.
+                                  reload();
+                                  const auto &parent = target();
+                                  QModelIndexList selection;
+                                  for (int row = 0; row < model->rowCount(parent) && row < options.edits; row++) {
+                                      selection.append(model->index(row, 0, parent));
+                                  }
+                                  manager.remove(selection);
+                                  undone = selection.count();
+                              },
+                              [&]() {
+                                  manager.undo();
+                                  return static_cast<qint64>(undone);
+                              }));
+    benchmarks.append(measure("manager.clear", model, options.repeat, reload, [&]() {
+        manager.remove(model->index(0, 0));
+        return items;
+    }));
+
+    // The diff runs on the protobuf missions only, one edit per component at
+    // most.
+    const auto &edited = editedMission(mission, options.edits);
+    benchmarks.append(measure("mission.diff", model, options.repeat, nullptr, [&]() {
+        Sink = Sink + mission::diff(mission, edited).count();
+        return items;
+    }));
+
+    QJsonObject mission_object;
+    mission_object["shape"] = ShapeNames[options.shape];
+    mission_object["components"] = options.components;
+    mission_object["elements"] = options.shape == kFlat ? 0 : options.elements;
+    mission_object["seed"] = QString::number(options.seed);
+    mission_object["items"] = items;
+    mission_object["bytes"] = static_cast<qint64>(mission.ByteSizeLong());
+
+    QJsonArray benchmarks_array;
+    for (const auto &benchmark : benchmarks) {
+        benchmarks_array.append(toJson(benchmark));
+    }
+
+    QJsonObject root;
+    root["mission"] = mission_object;
+    root["benchmarks"] = benchmarks_array;
+    const auto &json = QJsonDocument(root).toJson();
+
+    QFile output(parser.value(output_option));
+    const auto &is_open = output.fileName().isEmpty() ? output.open(stdout, QIODevice::WriteOnly)
+                                                      : output.open(QIODevice::WriteOnly);
+    if (!is_open || output.write(json) != json.size()) {
+        qWarning() << "main" << __func__ << "writing the results fail";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,10 @@
+QT = core
+CONFIG += console
+CONFIG -= app_bundle
+TARGET = rtsys-mission-cli
+
+# Core
+include(../core/core.pri)
+
+# Main
+SOURCES += main.cpp
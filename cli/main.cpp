@@ -0,0 +1,461 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/diff.h"
+#include "core/file.h"
+#include "core/generator.h"
+#include "core/merge.h"
+#include "core/mission.h"
+#include "protobuf/mission.pb.h"
+
+#include <QAtomicInt>
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QSet>
+#include <QTextStream>
+#include <QThread>
+
+#include <google/protobuf/arena.h>
+
+#include <memory>
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The commands of the batch processor, the names below are in the same order.
+enum Command { kLoad, kValidate, kConvert, kMerge, kSplit, kStats, kGenerate, kDiff, kMerge3, kNoCommand };
+
+const char *const CommandNames[] = {"load",     "validate", "convert", "merge", "split",
+                                    "stats",    "generate", "diff",    "merge3"};
+
+// The options of a batch run, as given on the command line.
+struct Options {
+    Command command;
+    QString output;
+    bool is_plain;
+    int parts;
+    int jobs;
+    mission::GeneratorOptions generator;
+};
+
+// The outcome of the processing of one mission file.
+struct Result {
+    bool success = false;
+    qint64 bytes = 0;
+    qint64 nsecs = 0;
+    mission::Stats stats;
+    QStringList messages;
+};
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Runs the given function on the position of each of the given files, on the
+// given number of threads. Each thread takes the next file once done with the
+// previous one, so that the threads are kept busy whatever the size of each
+// file.
+template <class Function>
+static void forEachFile(const QStringList &paths, int jobs, Function function)
+{
+    QAtomicInt next(0);
+    QVector<QThread *> threads;
+    for (int i = 0; i < qMin(jobs, paths.count()); i++) {
+        threads.append(QThread::create([&]() {
+            for (int file; (file = next.fetchAndAddRelaxed(1)) < paths.count();) {
+                function(file);
+            }
+        }));
+        threads.last()->start();
+    }
+    for (auto *thread : threads) {
+        thread->wait();
+        delete thread;
+    }
+}
+
+// Writes the given mission into the file specified by the given path, in the
+// plain or the streaming mission format.
+static bool writeMission(const QString &path, const pb::mission::Mission &mission, bool is_plain,
+                         qint64 *bytes = nullptr)
+{
+    return is_plain ? file::write(path, mission, bytes) : file::writeStream(path, mission, bytes);
+}
+
+// Returns the path of the file the given mission file is converted into, the
+// file of the same name in the output directory.
+static QString convertPathOf(const QString &path, const Options &options)
+{
+    return QDir(options.output).filePath(QFileInfo(path).fileName());
+}
+
+// Returns the problem of the conversion of the given files, if any. The files
+// are converted in parallel, so that two files of the same name would be
+// written into the same output file at once, and a file converted into its
+// own directory would be overwritten while being read. The output directory
+// must exist.
+static QString convertProblemOf(const QStringList &paths, const Options &options)
+{
+    const auto &directory = QDir(options.output).canonicalPath();
+    QSet<QString> outputs;
+    for (const auto &path : paths) {
+        const QFileInfo info(path);
+        const auto &output_path = QDir(directory).filePath(info.fileName());
+        if (output_path == info.canonicalFilePath()) return "the convert command would overwrite " + path;
+        if (outputs.contains(output_path)) return "the convert command would write " + output_path + " twice";
+        outputs.insert(output_path);
+    }
+    return QString();
+}
+
+// Splits the given mission into the given number of parts, written into the
+// output directory. The components are split in order, into parts of about
+// the same serialized size, and each part keeps the mission name.
+static bool splitMission(const pb::mission::Mission &mission, const QString &path, const Options &options,
+                         QStringList *messages)
+{
+    const auto &count = mission.components_size();
+    QVector<qint64> sizes(count);
+    qint64 total = 0;
+    for (int i = 0; i < count; i++) {
+        sizes[i] = static_cast<qint64>(mission.components(i).ByteSizeLong());
+        total += sizes.at(i);
+    }
+
+    // A component goes to the part its middle byte falls into.
+    const auto parts = qMin(options.parts, qMax(count, 1));
+    std::vector<pb::mission::Mission> splits(parts);
+    qint64 done = 0;
+    for (int i = 0; i < count; i++) {
+        const auto &part = total ? qMin<qint64>((done + sizes.at(i) / 2) * parts / total, parts - 1)
+                                 : static_cast<qint64>(i) * parts / count;
+        *splits[part].add_components() = mission.components(i);
+        done += sizes.at(i);
+    }
+
+    const QFileInfo info(path);
+    for (int part = 0; part < parts; part++) {
+        auto name = QString("%1.%2").arg(info.completeBaseName()).arg(part);
+        if (!info.suffix().isEmpty()) name += "." + info.suffix();
+
+        const auto &split_path = QDir(options.output).filePath(name);
+        splits[part].set_name(mission.name());
+        if (!writeMission(split_path, splits[part], options.is_plain)) {
+            messages->append("writing " + split_path + " fail");
+            return false;
+        }
+    }
+    return true;
+}
+
+// Processes the mission file specified by the given path with the command of
+// the given options. The mission is loaded on its own arena, released at once
+// when done.
+static Result processFile(const QString &path, const Options &options)
+{
+    Result result;
+    QElapsedTimer timer;
+    timer.start();
+
+    google::protobuf::Arena arena(mission::arenaOptions());
+    auto *mission = google::protobuf::Arena::CreateMessage<pb::mission::Mission>(&arena);
+    if (!file::load(path, mission, &result.bytes)) {
+        result.messages.append("loading fail");
+        return result;
+    }
+
+    result.success = true;
+    switch (options.command) {
+        case kValidate:
+            result.messages = mission::validate(*mission);
+            result.success = result.messages.isEmpty();
+            break;
+        case kConvert: {
+            const auto &output_path = convertPathOf(path, options);
+            result.success = writeMission(output_path, *mission, options.is_plain);
+            if (!result.success) result.messages.append("writing " + output_path + " fail");
+            break;
+        }
+        case kSplit:
+            result.success = splitMission(*mission, path, options, &result.messages);
+            break;
+        case kStats:
+            result.stats = mission::statsOf(*mission);
+            break;
+        default:
+            break;
+    }
+    result.nsecs = timer.nsecsElapsed();
+    return result;
+}
+
+// Generates the synthetic mission of the given position then writes it into
+// the file specified by the given path. Each file has its own seed, the seed
+// of the options plus its position, and is generated by a single thread since
+// the files already are generated in parallel.
+static Result generateFile(const QString &path, int file, const Options &options)
+{
+    Result result;
+    QElapsedTimer timer;
+    timer.start();
+
+    auto generator = options.generator;
+    generator.seed += static_cast<quint64>(file);
+    generator.threads = 1;
+    google::protobuf::Arena arena(mission::arenaOptions());
+    auto *mission = google::protobuf::Arena::CreateMessage<pb::mission::Mission>(&arena);
+    mission::generate(generator, mission);
+
+    result.success = writeMission(path, *mission, options.is_plain, &result.bytes);
+    if (!result.success) result.messages.append("writing fail");
+    result.nsecs = timer.nsecsElapsed();
+    return result;
+}
+
+// Loads the missions of the given files in parallel, each one onto its own
+// arena. Returns the missions in the order of the files, none if a file fails
+// to load.
+static QVector<pb::mission::Mission *> loadFiles(const QStringList &paths, const Options &options,
+                                                 std::vector<std::unique_ptr<google::protobuf::Arena>> *arenas,
+                                                 QVector<Result> *results)
+{
+    arenas->resize(paths.count());
+    QVector<pb::mission::Mission *> missions(paths.count(), nullptr);
+    auto *loaded = missions.data();
+    auto *data = results->data();
+    forEachFile(paths, options.jobs, [&](int file) {
+        QElapsedTimer timer;
+        timer.start();
+        (*arenas)[file].reset(new google::protobuf::Arena(mission::arenaOptions()));
+        auto *mission = google::protobuf::Arena::CreateMessage<pb::mission::Mission>((*arenas)[file].get());
+        data[file].success = file::load(paths.at(file), mission, &data[file].bytes);
+        if (data[file].success)
+            loaded[file] = mission;
+        else
+            data[file].messages.append("loading fail");
+        data[file].nsecs = timer.nsecsElapsed();
+    });
+    if (missions.contains(nullptr)) return QVector<pb::mission::Mission *>();
+    return missions;
+}
+
+// Merges the missions of the given files into the output file, in the order
+// of the files: their components are appended in order. The merged mission is
+// named after the first one.
+static bool mergeFiles(const QStringList &paths, const Options &options, QVector<Result> *results)
+{
+    std::vector<std::unique_ptr<google::protobuf::Arena>> arenas;
+    const auto &missions = loadFiles(paths, options, &arenas, results);
+    if (missions.isEmpty()) return false;
+
+    pb::mission::Mission merged;
+    merged.set_name(missions.first()->name());
+    for (const auto *mission : missions) {
+        merged.mutable_components()->MergeFrom(mission->components());
+    }
+    return writeMission(options.output, merged, options.is_plain);
+}
+
+// Diffs the mission of the second given file against the mission of the first
+// one. The edit script is given as the messages of the second file, after the
+// number of edits and the diff time.
+static bool diffFiles(const QStringList &paths, const Options &options, QVector<Result> *results)
+{
+    std::vector<std::unique_ptr<google::protobuf::Arena>> arenas;
+    const auto &missions = loadFiles(paths, options, &arenas, results);
+    if (missions.isEmpty()) return false;
+
+    QElapsedTimer timer;
+    timer.start();
+    const auto &diff = mission::diff(*missions.at(0), *missions.at(1));
+    const auto &nsecs = timer.nsecsElapsed();
+
+    auto &result = (*results)[1];
+    result.messages.append(QString("%1 edits in %2 ms").arg(diff.count()).arg(nsecs / 1e6));
+    result.messages += mission::describe(diff);
+    return true;
+}
+
+// Merges the edits of the mission of the third given file into the mission of
+// the second one, given the mission of the first one they were both edited
+// from, then writes the merged mission into the output file. The conflicts
+// are given as the messages of the third file, the merged mission keeps the
+// rows of the second one.
+static bool merge3Files(const QStringList &paths, const Options &options, QVector<Result> *results)
+{
+    std::vector<std::unique_ptr<google::protobuf::Arena>> arenas;
+    const auto &missions = loadFiles(paths, options, &arenas, results);
+    if (missions.isEmpty()) return false;
+
+    QElapsedTimer timer;
+    timer.start();
+    const auto &conflicts = mission::merge(*missions.at(0), *missions.at(2), missions.at(1));
+    const auto &nsecs = timer.nsecsElapsed();
+
+    auto &result = (*results)[2];
+    result.success = conflicts.isEmpty();
+    result.messages.append(QString("%1 conflicts in %2 ms").arg(conflicts.count()).arg(nsecs / 1e6));
+    result.messages += mission::describe(conflicts);
+    return writeMission(options.output, *missions.at(1), options.is_plain);
+}
+
+// ===
+// === Main
+// ============================================================================ //
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("rtsys-mission-cli");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        "Processes mission files in bulk, on every core.\n"
+        "  load      Loads the files, giving the load time of each one.\n"
+        "  validate  Checks the files, giving the problems of each one.\n"
+        "  convert   Writes the files again into the output directory.\n"
+        "  merge     Merges the files, in order, into the output file.\n"
+        "  split     Splits each file into parts, into the output directory.\n"
+        "  stats     Counts the components of the files.\n"
+        "  generate  Generates synthetic missions into the files.\n"
+        "  diff      Diffs the second file against the first one.\n"
+        "  merge3    Merges the third file into the second one, both edited from the first one, into the output\n"
+        "            file.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("command", "load, validate, convert, merge, split, stats, generate, diff or merge3.");
+    parser.addPositionalArgument("files", "The mission files, plain or streaming.", "files...");
+    const QCommandLineOption output_option({"o", "output"}, "The output file (merge) or directory.", "path");
+    const QCommandLineOption plain_option("plain", "Writes the plain mission format, not the streaming one.");
+    const QCommandLineOption parts_option("parts", "The number of parts of a split, 2 by default.", "count", "2");
+    const QCommandLineOption jobs_option({"j", "jobs"}, "The number of threads, one per core by default.", "count",
+                                         QString::number(QThread::idealThreadCount()));
+    const QCommandLineOption components_option("components", "The number of components generated, 10 by default.",
+                                               "count", "10");
+    const QCommandLineOption elements_option("elements", "The number of elements per collection generated, 10 by "
+                                             "default.", "count", "10");
+    const QCommandLineOption collections_option("collections", "The percentage of collections generated, 50 by "
+                                                "default.", "percent", "50");
+    const QCommandLineOption mix_option("mix", "The weights of the points, rails and segments generated, 1,1,1 by "
+                                        "default.", "weights", "1,1,1");
+    const QCommandLineOption seed_option("seed", "The seed of the first file generated, 0 by default.", "seed", "0");
+    parser.addOption(output_option);
+    parser.addOption(plain_option);
+    parser.addOption(parts_option);
+    parser.addOption(jobs_option);
+    parser.addOption(components_option);
+    parser.addOption(elements_option);
+    parser.addOption(collections_option);
+    parser.addOption(mix_option);
+    parser.addOption(seed_option);
+    parser.process(app);
+
+    auto paths = parser.positionalArguments();
+    if (paths.isEmpty()) parser.showHelp(1);
+
+    Options options;
+    options.command = kNoCommand;
+    for (int i = 0; i < kNoCommand; i++) {
+        if (paths.first() == CommandNames[i]) options.command = static_cast<Command>(i);
+    }
+    paths.removeFirst();
+    options.output = parser.value(output_option);
+    options.is_plain = parser.isSet(plain_option);
+    options.parts = qMax(parser.value(parts_option).toInt(), 1);
+    options.jobs = qMax(parser.value(jobs_option).toInt(), 1);
+    options.generator.components = qMax(parser.value(components_option).toInt(), 0);
+    options.generator.elements = qMax(parser.value(elements_option).toInt(), 0);
+    options.generator.collection_percent = qBound(0, parser.value(collections_option).toInt(), 100);
+    const auto &weights = parser.value(mix_option).split(',');
+    options.generator.point_weight = qMax(weights.value(0).toInt(), 0);
+    options.generator.rail_weight = qMax(weights.value(1).toInt(), 0);
+    options.generator.segment_weight = qMax(weights.value(2).toInt(), 0);
+    options.generator.seed = parser.value(seed_option).toULongLong();
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+    if (options.command == kNoCommand || paths.isEmpty()) parser.showHelp(1);
+    if ((options.command == kConvert || options.command == kMerge || options.command == kSplit ||
+         options.command == kMerge3) &&
+        options.output.isEmpty()) {
+        err << "the " << CommandNames[options.command] << " command needs an output\n";
+        return 1;
+    }
+    if (options.command == kDiff && paths.count() != 2) {
+        err << "the diff command needs two files\n";
+        return 1;
+    }
+    if (options.command == kMerge3 && paths.count() != 3) {
+        err << "the merge3 command needs three files\n";
+        return 1;
+    }
+    if ((options.command == kConvert || options.command == kSplit) && !QDir().mkpath(options.output)) {
+        err << "creating " << options.output << " fail\n";
+        return 1;
+    }
+    if (options.command == kConvert) {
+        const auto &problem = convertProblemOf(paths, options);
+        if (!problem.isEmpty()) {
+            err << problem << "\n";
+            return 1;
+        }
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    QVector<Result> results(paths.count());
+    auto success = true;
+    if (options.command == kMerge) {
+        success = mergeFiles(paths, options, &results);
+    } else if (options.command == kDiff) {
+        success = diffFiles(paths, options, &results);
+    } else if (options.command == kMerge3) {
+        success = merge3Files(paths, options, &results);
+    } else {
+        auto *data = results.data();
+        forEachFile(paths, options.jobs, [&](int file) {
+            if (options.command == kGenerate)
+                data[file] = generateFile(paths.at(file), file, options);
+            else
+                data[file] = processFile(paths.at(file), options);
+        });
+    }
+
+    // The results are given in the order of the files.
+    qint64 bytes = 0;
+    mission::Stats total;
+    for (int i = 0; i < paths.count(); i++) {
+        const auto &result = results.at(i);
+        success &= result.success;
+        bytes += result.bytes;
+        total += result.stats;
+
+        out << paths.at(i) << ": " << (result.success ? "ok" : "fail") << ", " << result.bytes << " bytes in "
+            << result.nsecs / 1e6 << " ms";
+        if (options.command == kStats) {
+            const auto &stats = result.stats;
+            out << ", " << stats.components << " components, " << stats.collections << " collections ("
+                << stats.scenarios << " scenarios, " << stats.routes << " routes, " << stats.families
+                << " families), " << stats.points << " points, " << stats.rails << " rails, " << stats.segments
+                << " segments";
+        }
+        out << "\n";
+        for (const auto &message : result.messages) {
+            out << "  " << message << "\n";
+        }
+    }
+
+    const auto &seconds = qMax<qint64>(timer.nsecsElapsed(), 1) / 1e9;
+    out << paths.count() << " files, " << bytes << " bytes in " << seconds * 1e3 << " ms, "
+        << paths.count() / seconds << " files/s, " << bytes / seconds / (1024 * 1024) << " MB/s";
+    if (options.command == kStats) {
+        out << ", " << total.components << " components, " << total.collections << " collections, " << total.points
+            << " points, " << total.rails << " rails, " << total.segments << " segments";
+    }
+    out << "\n";
+    return success ? 0 : 1;
+}
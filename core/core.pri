@@ -0,0 +1,11 @@
+# Links the headless mission library (see core.pro), which only depends on
+# QtCore and protobuf.
+INCLUDEPATH += $$PWD/..
+LIBS += -L$$shadowed($$PWD) -lrtsys-mission-core -lprotobuf
+
+win32-msvc*: PRE_TARGETDEPS += $$shadowed($$PWD)/rtsys-mission-core.lib
+else: PRE_TARGETDEPS += $$shadowed($$PWD)/librtsys-mission-core.a
+
+# The probes of the hot paths are compiled in with 'qmake CONFIG+=mission_stats'
+# (see stats.h).
+mission_stats: DEFINES += RTSYS_MISSION_STATS
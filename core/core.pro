@@ -0,0 +1,15 @@
+TEMPLATE = lib
+CONFIG += staticlib
+QT = core
+TARGET = rtsys-mission-core
+INCLUDEPATH += $$PWD/..
+
+# Protbuf
+OTHER_FILES += ../protobuf/mission.proto
+HEADERS += ../protobuf/mission.pb.h
+SOURCES += ../protobuf/mission.pb.cc
+
+# Mission
+HEADERS += mission.h generator.h stats.h history.h snapshot.h diff.h merge.h file.h loader.h journal.h
+SOURCES += mission.cpp generator.cpp stats.cpp history.cpp snapshot.cpp diff.cpp merge.cpp
+SOURCES += file.cpp loader.cpp journal.cpp
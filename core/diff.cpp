@@ -0,0 +1,484 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/diff.h"
+
+#include <QHash>
+
+#include <algorithm>
+#include <cstring>
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The number of rows looked up ahead to align the rows again after a mismatch,
+// see matchAligned.
+const int DiffAlignWindow = 16;
+
+// ===
+// === Function
+// ============================================================================ //
+
+namespace mission {
+
+// Returns the given hash mixed with the given value, with the finalizer of
+// SplitMix64 so that the order of the values matters.
+static quint64 mix(quint64 hash, quint64 value)
+{
+    auto z = hash ^ (value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2));
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Returns the hash of the given string, read by words of 8 bytes. The hash
+// is only good enough once mixed, see mix.
+static quint64 hashOf(const std::string &string)
+{
+    const auto *data = string.data();
+    const auto &size = string.size();
+    quint64 hash = size;
+    size_t i = 0;
+    for (; i + sizeof(quint64) <= size; i += sizeof(quint64)) {
+        quint64 word;
+        memcpy(&word, data + i, sizeof(quint64));
+        hash = (hash ^ word) * 0x9E3779B97F4A7C15ull;
+        hash ^= hash >> 32;
+    }
+    quint64 word = 0;
+    memcpy(&word, data + i, size - i);
+    return mix(hash, word);
+}
+
+// Returns the name of the given element, empty when it is none.
+static const std::string &nameOf(const pb::mission::Mission::Element &element)
+{
+    static const std::string no_name;
+
+    switch (element.element_case()) {
+        case pb::mission::Mission::Element::kPoint:
+            return element.point().name();
+        case pb::mission::Mission::Element::kRail:
+            return element.rail().name();
+        case pb::mission::Mission::Element::kSegment:
+            return element.segment().name();
+        default:
+            return no_name;
+    }
+}
+
+// Returns the name of the given component, see nameOf(Element).
+static const std::string &nameOf(const pb::mission::Mission::Component &component)
+{
+    return component.has_collection() ? component.collection().name() : nameOf(component.element());
+}
+
+// Returns the hash of the given point of a rail or a segment, zero when unset.
+static quint64 hashOf(bool has_point, const pb::mission::Mission::Element::Point &point)
+{
+    return has_point ? hashOf(point.name()) : 0;
+}
+
+// Returns the row of the given element.
+static DiffRow rowOf(const pb::mission::Mission::Element &element)
+{
+    DiffRow row;
+    row.type = componentTypeOf(element);
+    row.body = mix(0, row.type);
+    if (element.has_rail()) {
+        const auto &rail = element.rail();
+        row.body = mix(mix(row.body, hashOf(rail.has_p0(), rail.p0())), hashOf(rail.has_p1(), rail.p1()));
+    } else if (element.has_segment()) {
+        const auto &segment = element.segment();
+        row.body = mix(mix(row.body, hashOf(segment.has_p0(), segment.p0())), hashOf(segment.has_p1(), segment.p1()));
+    }
+    const auto &name = hashOf(nameOf(element));
+    row.hash = mix(row.body, name);
+    row.key = mix(row.type, name);
+    return row;
+}
+
+// Returns the row of the given component. The body of a collection is the
+// hash of its elements, in order.
+static DiffRow rowOf(const pb::mission::Mission::Component &component)
+{
+    if (!component.has_collection()) return rowOf(component.element());
+
+    DiffRow row;
+    row.type = kCollection;
+    row.body = mix(0, row.type);
+    for (const auto &element : component.collection().elements()) {
+        row.body = mix(row.body, rowOf(element).hash);
+    }
+    const auto &name = hashOf(component.collection().name());
+    row.hash = mix(row.body, name);
+    row.key = mix(row.type, name);
+    return row;
+}
+
+// Returns the rows of the given protobuf messages.
+template <class Message>
+static QVector<DiffRow> rowsOfMessages(const google::protobuf::RepeatedPtrField<Message> &messages)
+{
+    QVector<DiffRow> rows;
+    rows.reserve(messages.size());
+    for (const auto &message : messages) {
+        rows.append(rowOf(message));
+    }
+    return rows;
+}
+
+// Returns the rows of the given components.
+QVector<DiffRow> rowsOf(const google::protobuf::RepeatedPtrField<pb::mission::Mission::Component> &components)
+{
+    return rowsOfMessages(components);
+}
+
+// Returns the rows of the given elements.
+QVector<DiffRow> rowsOf(const google::protobuf::RepeatedPtrField<pb::mission::Mission::Element> &elements)
+{
+    return rowsOfMessages(elements);
+}
+
+// Returns the hash of the given element, equal elements have the same hash.
+quint64 hashOf(const pb::mission::Mission::Element &element)
+{
+    return rowOf(element).hash;
+}
+
+// Returns the hash of the given component, equal components have the same
+// hash. The hash of a collection covers its elements.
+quint64 hashOf(const pb::mission::Mission::Component &component)
+{
+    return rowOf(component).hash;
+}
+
+// Matches the given rows.
+static void match(DiffMatching *matching, int old_row, int new_row)
+{
+    matching->new_rows[old_row] = new_row;
+    matching->old_rows[new_row] = old_row;
+}
+
+// Matches the unmatched rows of the given ranges which have the same value of
+// the given hash, in order: the first old row of a hash goes with the first
+// new row of the hash.
+static void matchBy(quint64 DiffRow::*hash, const QVector<DiffRow> &old_rows, const QVector<DiffRow> &new_rows,
+                    int first, int old_last, int new_last, DiffMatching *matching)
+{
+    QHash<quint64, int> heads;
+    QVector<int> next(old_last - first, -1);
+    heads.reserve(old_last - first);
+    for (int i = old_last - 1; i >= first; i--) {
+        if (matching->new_rows.at(i) >= 0) continue;
+        const auto &value = old_rows.at(i).*hash;
+        next[i - first] = heads.value(value, -1);
+        heads.insert(value, i);
+    }
+    for (int j = first; j < new_last && !heads.isEmpty(); j++) {
+        if (matching->old_rows.at(j) >= 0) continue;
+        auto it = heads.find(new_rows.at(j).*hash);
+        if (it == heads.end() || it.value() < 0) continue;
+        const auto i = it.value();
+        it.value() = next.at(i - first);
+        match(matching, i, j);
+    }
+}
+
+// Matches the rows of the given ranges which are still aligned. Both ranges are
+// walked at once, matching the rows of the same hash. On a mismatch, the rows
+// are looked up a few rows ahead, so that the rows after a few rows inserted
+// or removed are aligned again. Otherwise both rows are left to the hash
+// tables (see matchBy), which then only index the rows changed or moved.
+static void matchAligned(const QVector<DiffRow> &old_rows, const QVector<DiffRow> &new_rows, int first, int old_last,
+                         int new_last, DiffMatching *matching)
+{
+    auto i = first;
+    auto j = first;
+    while (i < old_last && j < new_last) {
+        if (old_rows.at(i).hash == new_rows.at(j).hash) {
+            match(matching, i++, j++);
+            continue;
+        }
+
+        auto skip = 1;
+        for (; skip <= DiffAlignWindow; skip++) {
+            if (j + skip < new_last && old_rows.at(i).hash == new_rows.at(j + skip).hash) {
+                j += skip;
+                break;
+            }
+            if (i + skip < old_last && old_rows.at(i + skip).hash == new_rows.at(j).hash) {
+                i += skip;
+                break;
+            }
+        }
+        if (skip > DiffAlignWindow) {
+            i++;
+            j++;
+        }
+    }
+}
+
+// Marks the matched new rows of the given range which are out of the order of
+// the old rows as moved. The rows kept in place are the longest sequence of
+// new rows whose old rows are in order, found by patience sorting, unless all
+// of them already are in order.
+static void markMoved(int first, int new_last, DiffMatching *matching)
+{
+    auto is_ordered = true;
+    for (int j = first, last = -1; j < new_last && is_ordered; j++) {
+        const auto &i = matching->old_rows.at(j);
+        if (i < 0) continue;
+        is_ordered = i > last;
+        last = i;
+    }
+    if (is_ordered) return;
+
+    QVector<int> rows;
+    QVector<int> tails;
+    QVector<int> previous(new_last - first, -1);
+    for (int j = first; j < new_last; j++) {
+        const auto &i = matching->old_rows.at(j);
+        if (i < 0) continue;
+
+        const auto &it = std::lower_bound(tails.begin(), tails.end(), i);
+        const auto &length = static_cast<int>(it - tails.begin());
+        if (length) previous[j - first] = rows.at(length - 1);
+        if (it == tails.end()) {
+            tails.append(i);
+            rows.append(j);
+        } else {
+            *it = i;
+            rows[length] = j;
+        }
+    }
+
+    for (int j = first; j < new_last; j++) {
+        matching->is_moved[j] = matching->old_rows.at(j) >= 0;
+    }
+    for (int j = rows.isEmpty() ? -1 : rows.last(); j >= 0; j = previous.at(j - first)) {
+        matching->is_moved[j] = false;
+    }
+}
+
+// Returns true if the given rows may be the same row changed: elements of the
+// same type and body, so only renamed, or collections, whose elements are then
+// diffed.
+static bool isAlike(const DiffRow &old_row, const DiffRow &new_row)
+{
+    return old_row.type == new_row.type && (old_row.type == kCollection || old_row.body == new_row.body);
+}
+
+// Matches the unmatched rows of the given ranges by position: between two rows
+// kept in place, each unmatched new row is paired in order with the next
+// unmatched old row alike, looked up a few rows ahead so that a row removed or
+// inserted next to it doesn't hide it.
+static void matchByPosition(const QVector<DiffRow> &old_rows, const QVector<DiffRow> &new_rows, int first,
+                            int old_last, int new_last, DiffMatching *matching)
+{
+    auto i = first;
+    auto j = first;
+    for (int anchor = first; anchor <= new_last; anchor++) {
+        if (anchor < new_last && (matching->old_rows.at(anchor) < 0 || matching->is_moved.at(anchor))) continue;
+
+        const auto &old_anchor = anchor < new_last ? matching->old_rows.at(anchor) : old_last;
+        for (; j < anchor && i < old_anchor; j++) {
+            if (matching->old_rows.at(j) >= 0) continue;
+
+            auto alike = -1;
+            for (int k = i; k < old_anchor && k <= i + DiffAlignWindow && alike < 0; k++) {
+                if (matching->new_rows.at(k) < 0 && isAlike(old_rows.at(k), new_rows.at(j))) alike = k;
+            }
+            if (alike < 0) continue;
+
+            match(matching, alike, j);
+            i = alike + 1;
+        }
+        i = old_anchor + 1;
+        j = anchor + 1;
+    }
+}
+
+// Returns the matching of the given rows. The rows at the start and at the end
+// with the same hash are matched right away, the diff of missions alike only
+// compares hashes. The rows in between are matched while aligned, then by
+// hash, then by type and name, and the rows left by position.
+DiffMatching matchRows(const QVector<DiffRow> &old_rows, const QVector<DiffRow> &new_rows)
+{
+    DiffMatching matching;
+    matching.new_rows = QVector<int>(old_rows.count(), -1);
+    matching.old_rows = QVector<int>(new_rows.count(), -1);
+    matching.is_moved = QVector<bool>(new_rows.count(), false);
+
+    const auto count = qMin(old_rows.count(), new_rows.count());
+    auto first = 0;
+    while (first < count && old_rows.at(first).hash == new_rows.at(first).hash) {
+        match(&matching, first, first);
+        first++;
+    }
+    auto old_last = old_rows.count();
+    auto new_last = new_rows.count();
+    while (old_last > first && new_last > first && old_rows.at(old_last - 1).hash == new_rows.at(new_last - 1).hash) {
+        match(&matching, --old_last, --new_last);
+    }
+    if (first == old_last || first == new_last) return matching;
+
+    matchAligned(old_rows, new_rows, first, old_last, new_last, &matching);
+    matchBy(&DiffRow::hash, old_rows, new_rows, first, old_last, new_last, &matching);
+    matchBy(&DiffRow::key, old_rows, new_rows, first, old_last, new_last, &matching);
+    markMoved(first, new_last, &matching);
+    matchByPosition(old_rows, new_rows, first, old_last, new_last, &matching);
+    return matching;
+}
+
+// Returns the given parent path followed by the given row.
+static QVector<int> pathOf(const QVector<int> &parent, int row)
+{
+    auto path = parent;
+    path.append(row);
+    return path;
+}
+
+// Returns true if the given path follows the given range of rows, under the
+// same parent. Empty paths, those of the rows missing from a mission, always
+// follow each other.
+static bool isNext(const QVector<int> &path, int count, const QVector<int> &next)
+{
+    if (path.isEmpty() || next.isEmpty()) return path.isEmpty() && next.isEmpty();
+    if (path.count() != next.count() || path.last() + count != next.last()) return false;
+    for (int i = 0; i < path.count() - 1; i++) {
+        if (path.at(i) != next.at(i)) return false;
+    }
+    return true;
+}
+
+// Appends the edit of the given row to the given diff, or extends the last
+// edit when it is of the same type on the rows right before.
+static void appendRange(DiffEdit::Type type, const QVector<int> &old_path, const QVector<int> &new_path, Diff *diff)
+{
+    if (!diff->isEmpty()) {
+        auto &last = diff->last();
+        if (last.type == type && isNext(last.old_path, last.count, old_path) &&
+            isNext(last.new_path, last.count, new_path)) {
+            last.count++;
+            return;
+        }
+    }
+    diff->append({type, old_path, new_path, 1, std::string()});
+}
+
+// Appends the edits turning the given old rows into the given new rows, under
+// the given parent paths, to the given diff. A matched row which changed is
+// renamed when its name changed, and given to the change function when its
+// body changed.
+template <class Name, class Change>
+static void appendEdits(const QVector<DiffRow> &old_rows, const QVector<DiffRow> &new_rows,
+                        const QVector<int> &old_parent, const QVector<int> &new_parent, Name name, Change change,
+                        Diff *diff)
+{
+    const auto &matching = matchRows(old_rows, new_rows);
+    for (int i = 0; i < old_rows.count(); i++) {
+        if (matching.new_rows.at(i) < 0) appendRange(DiffEdit::kRemove, pathOf(old_parent, i), QVector<int>(), diff);
+    }
+    for (int j = 0; j < new_rows.count(); j++) {
+        const auto &i = matching.old_rows.at(j);
+        if (i < 0) {
+            appendRange(DiffEdit::kInsert, QVector<int>(), pathOf(new_parent, j), diff);
+        } else if (matching.is_moved.at(j)) {
+            appendRange(DiffEdit::kMove, pathOf(old_parent, i), pathOf(new_parent, j), diff);
+        }
+    }
+    for (int j = 0; j < new_rows.count(); j++) {
+        const auto &i = matching.old_rows.at(j);
+        if (i < 0 || old_rows.at(i).hash == new_rows.at(j).hash) continue;
+
+        if (old_rows.at(i).key != new_rows.at(j).key) {
+            diff->append({DiffEdit::kRename, pathOf(old_parent, i), pathOf(new_parent, j), 1, name(j)});
+        }
+        if (old_rows.at(i).body != new_rows.at(j).body) change(i, j);
+    }
+}
+
+// Appends the edits turning the elements of the given old collection into the
+// elements of the given new collection to the given diff.
+static void diffElements(const pb::mission::Mission::Collection &from, const pb::mission::Mission::Collection &to,
+                         const QVector<int> &old_path, const QVector<int> &new_path, Diff *diff)
+{
+    appendEdits(
+        rowsOf(from.elements()), rowsOf(to.elements()), old_path, new_path,
+        [&](int row) { return nameOf(to.elements(row)); },
+        [&](int old_row, int new_row) {
+            diff->append({DiffEdit::kChange, pathOf(old_path, old_row), pathOf(new_path, new_row), 1, std::string()});
+        },
+        diff);
+}
+
+// Returns the edit script turning the first given mission into the second
+// one. The components, then the elements of the collections, are matched by
+// their hash first, so that the unchanged subtrees are never walked again.
+// The rows left are matched by type and name, then by position. The hashes
+// are 64 bits, subtrees of the same hash are taken for equal.
+Diff diff(const pb::mission::Mission &from, const pb::mission::Mission &to)
+{
+    Diff diff;
+    if (from.name() != to.name()) diff.append({DiffEdit::kRename, {}, {}, 1, to.name()});
+
+    appendEdits(
+        rowsOf(from.components()), rowsOf(to.components()), QVector<int>(), QVector<int>(),
+        [&](int row) { return nameOf(to.components(row)); },
+        [&](int old_row, int new_row) {
+            const auto &old_component = from.components(old_row);
+            const auto &new_component = to.components(new_row);
+            if (old_component.has_collection() && new_component.has_collection()) {
+                diffElements(old_component.collection(), new_component.collection(), {old_row}, {new_row}, &diff);
+            } else {
+                diff.append({DiffEdit::kChange, {old_row}, {new_row}, 1, std::string()});
+            }
+        },
+        &diff);
+    return diff;
+}
+
+// Returns the given path as text, the rows separated by slashes.
+static QString toString(const QVector<int> &path)
+{
+    if (path.isEmpty()) return "mission";
+
+    QStringList rows;
+    for (const auto &row : path) {
+        rows.append(QString::number(row));
+    }
+    return rows.join('/');
+}
+
+// Returns the given diff as text, one line per edit.
+QStringList describe(const Diff &diff)
+{
+    QStringList lines;
+    for (const auto &edit : diff) {
+        const auto &rows = edit.count > 1 ? QString(", %1 rows").arg(edit.count) : QString();
+        switch (edit.type) {
+            case DiffEdit::kInsert:
+                lines.append("insert " + toString(edit.new_path) + rows);
+                break;
+            case DiffEdit::kRemove:
+                lines.append("remove " + toString(edit.old_path) + rows);
+                break;
+            case DiffEdit::kMove:
+                lines.append("move " + toString(edit.old_path) + " -> " + toString(edit.new_path) + rows);
+                break;
+            case DiffEdit::kRename:
+                lines.append("rename " + toString(edit.old_path) + " -> " + toString(edit.new_path) + " \"" +
+                             QString::fromStdString(edit.name) + "\"");
+                break;
+            case DiffEdit::kChange:
+                lines.append("change " + toString(edit.old_path) + " -> " + toString(edit.new_path));
+                break;
+        }
+    }
+    return lines;
+}
+
+} // namespace mission
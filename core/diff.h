@@ -0,0 +1,88 @@
+#ifndef RTSYS_MISSION_DIFF_H
+#define RTSYS_MISSION_DIFF_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/mission.h"
+#include "protobuf/mission.pb.h"
+
+#include <QStringList>
+#include <QVector>
+
+#include <string>
+
+// ===
+// === Define
+// ============================================================================ //
+
+namespace mission {
+
+// An edit of the script turning a mission into another one. The rows of the
+// old mission are given by their old path, the rows of the new mission by
+// their new path: the row of the component, then the row of the element for
+// an element of a collection. An empty path is the mission itself.
+//  - Insert: the rows from the new path were inserted.
+//  - Remove: the rows from the old path were removed.
+//  - Move: the rows from the old path were moved to the new path.
+//  - Rename: the row was given the name. The elements of a renamed collection
+//    are diffed on their own.
+//  - Change: the element changed otherwise, like the points of a rail.
+// The edits are ordered per list of rows: for the components, the removals
+// come first, then the insertions and the moves, then the renames and the
+// changes of each component in turn. The edits of the elements of a changed
+// collection, in the same order, come right after the rename of the
+// collection, so before the renames and the changes of the next components.
+// Consecutive rows inserted, removed or moved together make a single edit of
+// the given count.
+struct DiffEdit {
+    enum Type { kInsert, kRemove, kMove, kRename, kChange };
+
+    Type type;
+    QVector<int> old_path;
+    QVector<int> new_path;
+    int count;
+    std::string name;
+};
+
+typedef QVector<DiffEdit> Diff;
+
+// The hashes of a row of a diffed list, a component of the mission or an
+// element of a collection.
+//  - hash: of the whole subtree, the rows of the same hash are equal.
+//  - body: of the subtree but its name, a renamed row keeps its body.
+//  - key: of the component type and the name, a changed row keeps its key.
+struct DiffRow {
+    quint64 hash;
+    quint64 body;
+    quint64 key;
+    Component type;
+};
+
+// The matching of the rows of two lists: the new row of each old row and the
+// old row of each new row, -1 when unmatched, and whether each new row was
+// moved out of the order of the old rows. A matched row has the same type in
+// both lists.
+struct DiffMatching {
+    QVector<int> new_rows;
+    QVector<int> old_rows;
+    QVector<bool> is_moved;
+};
+
+// ===
+// === Function
+// ============================================================================ //
+
+quint64 hashOf(const pb::mission::Mission::Element &element);
+quint64 hashOf(const pb::mission::Mission::Component &component);
+QVector<DiffRow> rowsOf(const google::protobuf::RepeatedPtrField<pb::mission::Mission::Component> &components);
+QVector<DiffRow> rowsOf(const google::protobuf::RepeatedPtrField<pb::mission::Mission::Element> &elements);
+DiffMatching matchRows(const QVector<DiffRow> &old_rows, const QVector<DiffRow> &new_rows);
+
+Diff diff(const pb::mission::Mission &from, const pb::mission::Mission &to);
+QStringList describe(const Diff &diff);
+
+} // namespace mission
+
+#endif // RTSYS_MISSION_DIFF_H
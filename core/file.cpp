@@ -0,0 +1,598 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/file.h"
+#include "protobuf/mission.pb.h"
+
+#include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+#include <array>
+#include <cstring>
+#include <limits>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The header of the streaming mission format, the magic then the version.
+// The version 1 has no index, it is still read.
+const char StreamMagic[] = {'R', 'T', 'S', 'M'};
+const quint32 StreamVersion = 2;
+const int StreamHeaderSize = sizeof(StreamMagic) + sizeof(StreamVersion);
+
+// The trailer of the streaming mission format, which ends the file from the
+// version 2 on: the offset, the size and the CRC-32 of the index, then the
+// magic.
+const char IndexMagic[] = {'R', 'T', 'S', 'I'};
+const int IndexTrailerSize = sizeof(quint64) + sizeof(quint32) + sizeof(quint32) + sizeof(IndexMagic);
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Parses the mission serialized into the file specified by the given path.
+// The file is memory-mapped and parsed through a zero-copy input stream, so
+// the file content is never read into an intermediate buffer: the peak
+// memory is the parsed mission only. The mission should be allocated on an
+// arena for the parsed messages to be allocated on it as well. A single
+// protobuf message can't exceed 2 GB, so a larger file is rejected (see the
+// streaming mission format for larger missions).
+bool file::read(const QString &path, pb::mission::Mission *mission, qint64 *bytes)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "file" << __func__ << "opening" << path << "fail:" << file.errorString();
+        return false;
+    }
+
+    const auto &size = file.size();
+    if (bytes) *bytes = size;
+    if (!size) {
+        mission->Clear();
+        return true;
+    }
+
+    const auto &limit = std::numeric_limits<int>::max();
+    if (size > limit) {
+        qWarning() << "file" << __func__ << "reading" << path << "fail: the file exceeds" << limit << "bytes";
+        return false;
+    }
+
+    auto *data = file.map(0, size);
+    if (!data) {
+        qWarning() << "file" << __func__ << "mapping" << path << "fail:" << file.errorString();
+        return false;
+    }
+
+    // The array input stream hands out the mapped memory itself to the parser.
+    google::protobuf::io::ArrayInputStream stream(data, static_cast<int>(size));
+    google::protobuf::io::CodedInputStream coded(&stream);
+    coded.SetTotalBytesLimit(limit);
+    const auto &parsed = mission->ParseFromCodedStream(&coded);
+    file.unmap(data);
+
+    if (!parsed) qWarning() << "file" << __func__ << "parsing" << path << "fail";
+    return parsed;
+}
+
+// Reads the mission of the file specified by the given path, whatever its
+// format: a streaming mission file is read record by record (through its
+// index, if any), any other file is parsed at once (see file::read). This is
+// the synchronous counterpart of the mission loader, for the batch tools.
+bool file::load(const QString &path, pb::mission::Mission *mission, qint64 *bytes)
+{
+    StreamReader reader(path);
+    if (!reader.open()) return !reader.hasError() && read(path, mission, bytes);
+
+    if (!reader.readHeader(mission)) {
+        qWarning() << "file" << __func__ << "reading" << path << "header fail";
+        return false;
+    }
+
+    const auto &is_indexed = reader.hasIndex();
+    const auto &count = is_indexed ? reader.index().components_size() : 0;
+    mission->mutable_components()->Reserve(count);
+    for (int i = 0; is_indexed ? i < count : !reader.atEnd(); i++) {
+        auto *component = mission->add_components();
+        if (is_indexed ? !reader.readComponent(i, component) : !reader.read(component)) {
+            qWarning() << "file" << __func__ << "reading" << path << "component" << i << "fail";
+            return false;
+        }
+    }
+    if (bytes) *bytes = reader.size();
+    return true;
+}
+
+// Serializes the mission into the file specified by the given path. The
+// mission is streamed into the file, it is never serialized into an
+// intermediate buffer. The file is replaced atomically once fully written.
+bool file::write(const QString &path, const pb::mission::Mission &mission, qint64 *bytes)
+{
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "file" << __func__ << "opening" << path << "fail:" << file.errorString();
+        return false;
+    }
+
+    google::protobuf::io::FileOutputStream stream(file.handle());
+    if (!mission.SerializeToZeroCopyStream(&stream) || !stream.Flush()) {
+        qWarning() << "file" << __func__ << "writing" << path << "fail";
+        file.cancelWriting();
+        return false;
+    }
+    if (bytes) *bytes = stream.ByteCount();
+    return file.commit();
+}
+
+// Returns the CRC-32 of the given data, the one of zlib.
+quint32 file::crc32(const uchar *data, qint64 size)
+{
+    static const auto table = []() {
+        std::array<quint32, 256> table;
+        for (quint32 i = 0; i < 256; i++) {
+            auto crc = i;
+            for (int bit = 0; bit < 8; bit++) {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+            }
+            table[i] = crc;
+        }
+        return table;
+    }();
+
+    quint32 crc = 0xFFFFFFFF;
+    for (qint64 i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+// Writes the given message as a length-delimited record, returns the size of
+// the record payload.
+static quint32 writeRecord(google::protobuf::io::CodedOutputStream *coded, const google::protobuf::Message &message)
+{
+    const auto &size = static_cast<quint32>(message.ByteSizeLong());
+    coded->WriteVarint32(size);
+    message.SerializeWithCachedSizes(coded);
+    return size;
+}
+
+// Records into the index entry the byte range of each element of the given
+// collection, whose component record payload starts at the entry offset. The
+// ranges follow from the serialization order of the fields: the collection tag
+// and length, the collection name, then the tag, the length and the payload of
+// each element. The sizes were cached by the serialization of the record.
+static void indexElements(pb::mission::MissionIndex::Component *entry,
+                          const pb::mission::Mission::Collection &collection)
+{
+    using google::protobuf::io::CodedOutputStream;
+
+    auto offset = entry->offset() + 1 + CodedOutputStream::VarintSize32(collection.GetCachedSize());
+    const auto &name_size = static_cast<quint32>(collection.name().size());
+    if (name_size) offset += 1 + CodedOutputStream::VarintSize32(name_size) + name_size;
+
+    entry->mutable_element_offsets()->Reserve(collection.elements_size());
+    entry->mutable_element_sizes()->Reserve(collection.elements_size());
+    for (const auto &element : collection.elements()) {
+        const auto &size = static_cast<quint32>(element.GetCachedSize());
+        offset += 1 + CodedOutputStream::VarintSize32(size);
+        entry->add_element_offsets(offset);
+        entry->add_element_sizes(size);
+        offset += size;
+    }
+}
+
+// Writes the trailer of the file, for the given serialized index which starts
+// at the given offset.
+static void writeTrailer(google::protobuf::io::CodedOutputStream *coded, quint64 offset, const std::string &index)
+{
+    coded->WriteLittleEndian64(offset);
+    coded->WriteLittleEndian32(static_cast<quint32>(index.size()));
+    coded->WriteLittleEndian32(file::crc32(reinterpret_cast<const uchar *>(index.data()), index.size()));
+    coded->WriteRaw(IndexMagic, sizeof(IndexMagic));
+}
+
+// Writes the mission header then the component records, from the given offset
+// of the file, and fills the index along. Returns the offset following the
+// last record. The components given an entry of the reader index (see
+// file::saveStream) aren't serialized: their record is left in place when
+// appending, otherwise it is copied as it is.
+static quint64 writeRecords(google::protobuf::io::CodedOutputStream *coded, quint64 offset,
+                            const pb::mission::Mission &mission, const QVector<int> &entries,
+                            const file::StreamReader *reader, bool append, pb::mission::MissionIndex *index)
+{
+    using google::protobuf::io::CodedOutputStream;
+
+    // The mission header holds every field of the mission but its components,
+    // which is only its name.
+    pb::mission::Mission header;
+    header.set_name(mission.name());
+    const auto &header_size = writeRecord(coded, header);
+    index->set_header_offset(offset + CodedOutputStream::VarintSize32(header_size));
+    index->set_header_size(header_size);
+    offset = index->header_offset() + header_size;
+
+    // The offsets are counted here, the coded stream counts on an int.
+    index->mutable_components()->Reserve(mission.components_size());
+    for (int i = 0; i < mission.components_size(); i++) {
+        const auto &position = reader ? entries.value(i, -1) : -1;
+        const auto *record = position >= 0 ? reader->record(position) : nullptr;
+        auto *entry = index->add_components();
+        if (record) {
+            *entry = reader->index().components(position);
+            if (append) continue;
+
+            coded->WriteVarint32(entry->size());
+            coded->WriteRaw(record, static_cast<int>(entry->size()));
+            const auto &shift = offset + CodedOutputStream::VarintSize32(entry->size()) - entry->offset();
+            entry->set_offset(entry->offset() + shift);
+            for (auto &element_offset : *entry->mutable_element_offsets()) {
+                element_offset += shift;
+            }
+            offset = entry->offset() + entry->size();
+            continue;
+        }
+
+        const auto &component = mission.components(i);
+        const auto &size = writeRecord(coded, component);
+        entry->set_offset(offset + CodedOutputStream::VarintSize32(size));
+        entry->set_size(size);
+        if (component.has_collection()) {
+            entry->set_name(component.collection().name());
+            indexElements(entry, component.collection());
+        }
+        offset = entry->offset() + size;
+    }
+    return offset;
+}
+
+// Flushes the data written to the file specified by the given handle down to
+// the disk.
+bool file::sync(int handle)
+{
+#ifdef Q_OS_WIN
+    return _commit(handle) == 0;
+#else
+    return fsync(handle) == 0;
+#endif
+}
+
+// Writes the whole streaming mission file, the records of the components given
+// an entry of the reader index are copied without being parsed.
+static bool rewriteStream(const QString &path, const pb::mission::Mission &mission, const QVector<int> &entries,
+                          const file::StreamReader *reader, qint64 *bytes)
+{
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "file" << __func__ << "opening" << path << "fail:" << file.errorString();
+        return false;
+    }
+
+    google::protobuf::io::FileOutputStream stream(file.handle());
+    auto error = false;
+    {
+        google::protobuf::io::CodedOutputStream coded(&stream);
+        coded.WriteRaw(StreamMagic, sizeof(StreamMagic));
+        coded.WriteLittleEndian32(StreamVersion);
+
+        pb::mission::MissionIndex index;
+        const auto &offset = writeRecords(&coded, StreamHeaderSize, mission, entries, reader, false, &index);
+        const auto &bytes = index.SerializeAsString();
+        coded.WriteString(bytes);
+        writeTrailer(&coded, offset, bytes);
+        error = coded.HadError();
+    }
+    if (error || !stream.Flush()) {
+        qWarning() << "file" << __func__ << "writing" << path << "fail";
+        file.cancelWriting();
+        return false;
+    }
+    if (bytes) *bytes = stream.ByteCount();
+    return file.commit();
+}
+
+// Appends to the streaming mission file read by the given reader the records
+// of the changed components, the header, the index then the trailer. The
+// trailer is written once everything else is on the disk, so that a save
+// interrupted by a crash leaves the previous trailer as the last valid one.
+// On failure, the file is truncated back to its previous size.
+static bool appendStream(const pb::mission::Mission &mission, const QVector<int> &entries,
+                         const file::StreamReader *reader, qint64 *bytes)
+{
+    QFile file(reader->path());
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append) || file.size() != reader->size()) {
+        qWarning() << "file" << __func__ << "opening" << reader->path() << "fail:" << file.errorString();
+        return false;
+    }
+
+    const auto &size = file.size();
+    google::protobuf::io::FileOutputStream stream(file.handle());
+    quint64 offset = size;
+    std::string index;
+    auto error = false;
+    {
+        google::protobuf::io::CodedOutputStream coded(&stream);
+        pb::mission::MissionIndex records;
+        offset = writeRecords(&coded, offset, mission, entries, reader, true, &records);
+        records.SerializeToString(&index);
+        coded.WriteString(index);
+        error = coded.HadError();
+    }
+    error = error || !stream.Flush() || !file::sync(file.handle());
+    if (!error) {
+        {
+            google::protobuf::io::CodedOutputStream coded(&stream);
+            writeTrailer(&coded, offset, index);
+            error = coded.HadError();
+        }
+        error = error || !stream.Flush() || !file::sync(file.handle());
+    }
+    if (error) {
+        qWarning() << "file" << __func__ << "writing" << reader->path() << "fail";
+        file.resize(size);
+        return false;
+    }
+    if (bytes) *bytes = stream.ByteCount();
+    return true;
+}
+
+// Serializes the mission into the file specified by the given path using the
+// streaming mission format (see file::StreamReader). Each component is its own
+// record, so the mission is never serialized as a single message. The index of
+// the records is built along and written at the end with its checksum.
+bool file::writeStream(const QString &path, const pb::mission::Mission &mission, qint64 *bytes)
+{
+    return rewriteStream(path, mission, QVector<int>(), nullptr, bytes);
+}
+
+// Saves the mission into the file specified by the given path using the
+// streaming mission format, serializing only the components which changed.
+// The 'entries' give, for each component of the mission, the position in the
+// reader index of the record holding the component unchanged, or -1 for a
+// component which changed. When the reader is the one of the file itself, the
+// changed components are appended to the file, the unchanged records are left
+// in place. The file is compacted, rewritten whole, once the bytes no longer
+// referenced would outweigh the records still referenced, so that it is never
+// much more than twice the size of the mission. Otherwise the file is written
+// whole, the unchanged records being copied from the reader without parsing.
+bool file::saveStream(const QString &path, const pb::mission::Mission &mission, const QVector<int> &entries,
+                      const StreamReader *reader, qint64 *bytes)
+{
+    if (!reader || !reader->hasIndex()) return rewriteStream(path, mission, QVector<int>(), nullptr, bytes);
+
+    quint64 referenced = 0;
+    for (int i = 0; i < mission.components_size(); i++) {
+        const auto &position = entries.value(i, -1);
+        if (position < 0 || !reader->record(position)) continue;
+
+        const auto &size = reader->index().components(position).size();
+        referenced += google::protobuf::io::CodedOutputStream::VarintSize32(size) + size;
+    }
+
+    const auto &is_same_file = QFileInfo(path).canonicalFilePath() == QFileInfo(reader->path()).canonicalFilePath();
+    const auto &unreferenced = static_cast<quint64>(reader->size()) - qMin<quint64>(referenced, reader->size());
+    if (is_same_file && unreferenced <= referenced && appendStream(mission, entries, reader, bytes)) return true;
+    return rewriteStream(path, mission, entries, reader, bytes);
+}
+
+// ===
+// === Class
+// ============================================================================ //
+
+file::StreamReader::StreamReader(const QString &path)
+    : _file(path)
+    , _data(nullptr)
+    , _size(0)
+    , _valid_size(0)
+    , _end(0)
+    , _offset(0)
+    , _error(false)
+    , _checksum(0)
+{
+}
+
+file::StreamReader::~StreamReader()
+{
+    if (_data) _file.unmap(_data);
+}
+
+// Opens the file then checks it is a streaming mission file. The file is
+// memory-mapped, which is immediate whatever the size of the file. The index
+// of the file, if any, is loaded as well. A streaming mission file whose index
+// can't be loaded fails to open with an error (see hasError), so that it isn't
+// taken for a plain mission file.
+bool file::StreamReader::open()
+{
+    if (!_file.open(QIODevice::ReadOnly)) return false;
+
+    _size = _file.size();
+    if (_size < StreamHeaderSize) return false;
+
+    _data = _file.map(0, _size);
+    if (!_data) return false;
+
+    google::protobuf::io::CodedInputStream coded(_data, StreamHeaderSize);
+    quint32 version = 0;
+    if (memcmp(_data, StreamMagic, sizeof(StreamMagic)) || !coded.Skip(sizeof(StreamMagic)) ||
+        !coded.ReadLittleEndian32(&version) || version < 1 || version > StreamVersion) {
+        return false;
+    }
+    _offset = StreamHeaderSize;
+    _valid_size = _end = _size;
+    if (version == 1) return true;
+
+    _error = !openIndex();
+    return !_error;
+}
+
+// Loads the index from the end of the file, the records end where the index
+// starts. The last trailer is the one of the last save. When it is malformed
+// or its index is corrupted, like after a save interrupted by a crash, the
+// previous trailers are looked for from the end of the file. When none is
+// valid but the last trailer is well-formed, the index is ignored and the
+// records are still read in sequence, only if the file was saved whole: the
+// records of a file saved incrementally are mixed with the headers, indexes
+// and trailers of the previous saves, which would be read as components.
+bool file::StreamReader::openIndex()
+{
+    qint64 offset = -1;
+    auto trailers = 0;
+    for (auto end = _size; end >= StreamHeaderSize + IndexTrailerSize; end--) {
+        if (memcmp(_data + end - sizeof(IndexMagic), IndexMagic, sizeof(IndexMagic))) continue;
+
+        qint64 trailer_offset = -1;
+        if (loadIndex(end, &trailer_offset)) {
+            if (end != _size) {
+                qWarning() << "file::StreamReader" << __func__ << _file.fileName()
+                           << "has a damaged end, the previous save is read";
+            }
+            return true;
+        }
+        if (trailer_offset >= 0) trailers++;
+        if (end == _size) offset = trailer_offset;
+    }
+
+    if (offset < 0) {
+        qWarning() << "file::StreamReader" << __func__ << _file.fileName() << "has a malformed trailer";
+        return false;
+    }
+    if (trailers > 1) {
+        qWarning() << "file::StreamReader" << __func__ << _file.fileName()
+                   << "has a corrupted index and was saved incrementally, it can't be read";
+        return false;
+    }
+    qWarning() << "file::StreamReader" << __func__ << _file.fileName() << "has a corrupted index, it is ignored";
+    _end = offset;
+    return true;
+}
+
+// Loads the index of the trailer ending at the given position of the file.
+// The offset of the index is given when the trailer is well-formed, even
+// though the index itself is corrupted. The index must end right before the
+// trailer and start after the file header, which is checked without adding
+// the offset read from the file, so that no offset can wrap around.
+bool file::StreamReader::loadIndex(qint64 end, qint64 *offset)
+{
+    const auto *trailer = _data + end - IndexTrailerSize;
+    google::protobuf::io::CodedInputStream coded(trailer, IndexTrailerSize);
+    uint64_t index_offset = 0;
+    quint32 size = 0;
+    quint32 checksum = 0;
+    const auto &index_end = static_cast<quint64>(end - IndexTrailerSize);
+    if (!coded.ReadLittleEndian64(&index_offset) || !coded.ReadLittleEndian32(&size) ||
+        !coded.ReadLittleEndian32(&checksum) || size > index_end - StreamHeaderSize ||
+        index_offset != index_end - size || size > static_cast<quint32>(std::numeric_limits<int>::max())) {
+        return false;
+    }
+    *offset = static_cast<qint64>(index_offset);
+
+    auto index = std::make_unique<pb::mission::MissionIndex>();
+    if (file::crc32(_data + index_offset, size) != checksum ||
+        !index->ParseFromArray(_data + index_offset, static_cast<int>(size))) {
+        return false;
+    }
+    _index = std::move(index);
+    _checksum = checksum;
+    _valid_size = end;
+    _end = *offset;
+    return true;
+}
+
+// Returns the index of the file, it must have one (see hasIndex).
+const pb::mission::MissionIndex &file::StreamReader::index() const
+{
+    return *_index;
+}
+
+// Reads the mission header into the given message. The header is the first
+// record, unless the index gives the one of the last save.
+bool file::StreamReader::readHeader(google::protobuf::Message *message)
+{
+    if (_index && _index->header_size()) return parse(_index->header_offset(), _index->header_size(), message);
+
+    return read(message);
+}
+
+// Reads the component specified by its position in the file into the given
+// message, using the index.
+bool file::StreamReader::readComponent(int component, google::protobuf::Message *message) const
+{
+    if (!_index || component < 0 || component >= _index->components_size()) return false;
+
+    const auto &entry = _index->components(component);
+    return parse(entry.offset(), entry.size(), message);
+}
+
+// Reads the element of the collection component specified by their positions
+// in the file into the given message, using the index.
+bool file::StreamReader::readElement(int component, int element, google::protobuf::Message *message) const
+{
+    if (!_index || component < 0 || component >= _index->components_size()) return false;
+
+    const auto &entry = _index->components(component);
+    if (element < 0 || element >= entry.element_offsets_size() || element >= entry.element_sizes_size()) return false;
+    return parse(entry.element_offsets(element), entry.element_sizes(element), message);
+}
+
+// Returns the payload of the record of the component specified by its position
+// in the file, or nullptr when the index doesn't match the file.
+const uchar *file::StreamReader::record(int component) const
+{
+    if (!_index || component < 0 || component >= _index->components_size()) return nullptr;
+
+    const auto &entry = _index->components(component);
+    return contains(entry.offset(), entry.size()) ? _data + entry.offset() : nullptr;
+}
+
+// Returns true if the given byte range lies within the records.
+bool file::StreamReader::contains(quint64 offset, quint64 size) const
+{
+    const auto &end = static_cast<quint64>(_end);
+    return offset >= StreamHeaderSize && offset <= end && size <= end - offset &&
+           size <= static_cast<quint64>(std::numeric_limits<int>::max());
+}
+
+// Parses the given byte range of the records into the given message.
+bool file::StreamReader::parse(quint64 offset, quint64 size, google::protobuf::Message *message) const
+{
+    if (!contains(offset, size) || !message->ParseFromArray(_data + offset, static_cast<int>(size))) {
+        qWarning() << "file::StreamReader" << __func__ << "parsing" << _file.fileName() << "fail at" << offset;
+        return false;
+    }
+    return true;
+}
+
+// Reads the next record into the given message, it is first cleared. The
+// record is parsed straight from the mapped memory.
+bool file::StreamReader::read(google::protobuf::Message *message)
+{
+    if (_error || atEnd()) return false;
+
+    // A length is a varint32, so it holds in 5 bytes at most.
+    google::protobuf::io::CodedInputStream coded(_data + _offset, static_cast<int>(qMin<qint64>(_end - _offset, 5)));
+    quint32 length = 0;
+    _error = !coded.ReadVarint32(&length);
+
+    const auto &start = _offset + coded.CurrentPosition();
+    _error = _error || length > static_cast<quint32>(std::numeric_limits<int>::max()) || start + length > _end ||
+             !message->ParseFromArray(_data + start, static_cast<int>(length));
+    if (_error) {
+        qWarning() << "file::StreamReader" << __func__ << "parsing" << _file.fileName() << "fail at" << _offset;
+        return false;
+    }
+    _offset = start + length;
+    return true;
+}
@@ -0,0 +1,109 @@
+#ifndef RTSYS_MISSION_FILE_H
+#define RTSYS_MISSION_FILE_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include <QFile>
+#include <QString>
+#include <QVector>
+
+#include <memory>
+
+// ===
+// === Define
+// ============================================================================ //
+
+namespace google {
+namespace protobuf {
+class Message;
+} // namespace protobuf
+} // namespace google
+
+namespace pb {
+namespace mission {
+class Mission;
+class MissionIndex;
+} // namespace mission
+} // namespace pb
+
+// ===
+// === Function
+// ============================================================================ //
+
+namespace file {
+
+bool read(const QString &path, pb::mission::Mission *mission, qint64 *bytes = nullptr);
+bool load(const QString &path, pb::mission::Mission *mission, qint64 *bytes = nullptr);
+bool write(const QString &path, const pb::mission::Mission &mission, qint64 *bytes = nullptr);
+bool writeStream(const QString &path, const pb::mission::Mission &mission, qint64 *bytes = nullptr);
+
+class StreamReader;
+bool saveStream(const QString &path, const pb::mission::Mission &mission, const QVector<int> &entries,
+                const StreamReader *reader, qint64 *bytes = nullptr);
+
+quint32 crc32(const uchar *data, qint64 size);
+bool sync(int handle);
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines the reader of the streaming mission format. A streaming file
+// starts with a magic and a version, followed by length-delimited records: the
+// mission header (the mission without its components) then each component of
+// the mission. The records are decoded one at a time from the memory-mapped
+// file, so the mission can be shown while it is being read and its size isn't
+// capped by the protobuf message size limit.
+// From the version 2 on, the records are followed by the index of the file (see
+// pb::mission::MissionIndex) and a trailer giving its position and checksum.
+// The index gives random access to any component or collection element, the
+// random access reads don't change the reader so they may run on any thread.
+// A file saved incrementally (see file::saveStream) holds the records of every
+// save, only the last index tells which ones make the mission. The file ends
+// with the trailer of that index unless a save was interrupted, the valid size
+// of the file stops at the trailer whatever follows it.
+class StreamReader
+{
+  public:
+    explicit StreamReader(const QString &path);
+    ~StreamReader();
+
+    bool open();
+    bool readHeader(google::protobuf::Message *message);
+    bool read(google::protobuf::Message *message);
+    bool atEnd() const { return _offset >= _end; }
+    bool hasError() const { return _error; }
+    qint64 offset() const { return _offset; }
+    qint64 size() const { return _size; }
+    qint64 validSize() const { return _valid_size; }
+    QString path() const { return _file.fileName(); }
+    quint32 checksum() const { return _checksum; }
+
+    bool hasIndex() const { return _index != nullptr; }
+    const pb::mission::MissionIndex &index() const;
+    bool readComponent(int component, google::protobuf::Message *message) const;
+    bool readElement(int component, int element, google::protobuf::Message *message) const;
+    const uchar *record(int component) const;
+
+  private:
+    bool openIndex();
+    bool loadIndex(qint64 end, qint64 *offset);
+    bool contains(quint64 offset, quint64 size) const;
+    bool parse(quint64 offset, quint64 size, google::protobuf::Message *message) const;
+
+    QFile _file;
+    uchar *_data;
+    qint64 _size;
+    qint64 _valid_size;
+    qint64 _end;
+    qint64 _offset;
+    bool _error;
+    quint32 _checksum;
+    std::unique_ptr<pb::mission::MissionIndex> _index;
+};
+
+} // namespace file
+
+#endif // RTSYS_MISSION_FILE_H
@@ -0,0 +1,116 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/generator.h"
+
+#include <QAtomicInt>
+#include <QThread>
+#include <QVector>
+
+#include <string>
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The number of components a generator thread takes at once.
+const int GeneratorChunkSize = 16;
+
+// ===
+// === Function
+// ============================================================================ //
+
+namespace mission {
+
+// Returns the next number of the given SplitMix64 state. The sequence only
+// depends on the initial state, on every platform.
+static quint64 nextRandom(quint64 *state)
+{
+    auto z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Sets the given element to a point, a rail or a segment drawn with the weights
+// of the given options. The points of a rail or a segment are always set.
+static void generateElement(const GeneratorOptions &options, quint64 *state, int index,
+                            pb::mission::Mission::Element *element)
+{
+    const auto &total = options.point_weight + options.rail_weight + options.segment_weight;
+    const auto &draw = total > 0 ? static_cast<int>(nextRandom(state) % static_cast<quint64>(total)) : 0;
+    const auto &number = std::to_string(index);
+    if (draw < options.point_weight || total <= 0) {
+        element->mutable_point()->set_name("P" + number);
+    } else if (draw < options.point_weight + options.rail_weight) {
+        auto *rail = element->mutable_rail();
+        rail->set_name("R" + number);
+        rail->mutable_p0()->set_name("R" + number + "A");
+        rail->mutable_p1()->set_name("R" + number + "B");
+    } else {
+        auto *segment = element->mutable_segment();
+        segment->set_name("S" + number);
+        segment->mutable_p0()->set_name("S" + number + "A");
+        segment->mutable_p1()->set_name("S" + number + "B");
+    }
+}
+
+// Generates the component of the given index. Each component draws from its
+// own state, seeded from the seed and the index, so that the mission doesn't
+// depend on the number of threads nor on the order the components are built.
+static void generateComponent(const GeneratorOptions &options, int index, pb::mission::Mission::Component *component)
+{
+    auto state = options.seed ^ (static_cast<quint64>(index) * 0xD1B54A32D192ED03ull);
+    if (static_cast<int>(nextRandom(&state) % 100) >= options.collection_percent) {
+        generateElement(options, &state, index, component->mutable_element());
+        return;
+    }
+
+    auto *collection = component->mutable_collection();
+    collection->set_name("C" + std::to_string(index));
+    auto *elements = collection->mutable_elements();
+    elements->Reserve(options.elements);
+    for (int i = 0; i < options.elements; i++) {
+        generateElement(options, &state, i, elements->Add());
+    }
+}
+
+// Generates a synthetic mission from the given options, the same options give
+// the same mission. The mission should be allocated on an arena, the arena
+// being thread-safe for allocation. The components are added first, then built
+// by several threads at once, each thread taking the next chunk of components
+// once done.
+void generate(const GeneratorOptions &options, pb::mission::Mission *mission)
+{
+    mission->set_name("Mission " + std::to_string(options.seed));
+    auto *components = mission->mutable_components();
+    components->Reserve(options.components);
+    for (int i = 0; i < options.components; i++) {
+        components->Add();
+    }
+
+    QAtomicInt next(0);
+    const auto &build = [&]() {
+        for (int first; (first = next.fetchAndAddRelaxed(GeneratorChunkSize)) < options.components;) {
+            for (int i = first; i < qMin(first + GeneratorChunkSize, options.components); i++) {
+                generateComponent(options, i, components->Mutable(i));
+            }
+        }
+    };
+
+    const auto &chunks = (options.components + GeneratorChunkSize - 1) / GeneratorChunkSize;
+    const auto count = qMin(options.threads > 0 ? options.threads : QThread::idealThreadCount(), chunks);
+    QVector<QThread *> threads;
+    for (int i = 1; i < count; i++) {
+        threads.append(QThread::create(build));
+        threads.last()->start();
+    }
+    build();
+    for (auto *thread : threads) {
+        thread->wait();
+        delete thread;
+    }
+}
+
+} // namespace mission
@@ -0,0 +1,40 @@
+#ifndef RTSYS_MISSION_GENERATOR_H
+#define RTSYS_MISSION_GENERATOR_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include "protobuf/mission.pb.h"
+
+#include <QtGlobal>
+
+// ===
+// === Define
+// ============================================================================ //
+
+namespace mission {
+
+// The options of the synthetic mission generator. A component is a collection
+// with the given probability, otherwise a top-level element. The elements are
+// points, rails and segments drawn with the given weights.
+struct GeneratorOptions {
+    int components = 10;
+    int elements = 10;
+    int collection_percent = 50;
+    int point_weight = 1;
+    int rail_weight = 1;
+    int segment_weight = 1;
+    quint64 seed = 0;
+    int threads = 0;
+};
+
+// ===
+// === Function
+// ============================================================================ //
+
+void generate(const GeneratorOptions &options, pb::mission::Mission *mission);
+
+} // namespace mission
+
+#endif // RTSYS_MISSION_GENERATOR_H
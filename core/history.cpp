@@ -0,0 +1,200 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/history.h"
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The estimated bytes held by a change and by a message besides their data.
+const qint64 ChangeOverhead = sizeof(MissionHistory::Change) + 64;
+const qint64 MessageOverhead = sizeof(QByteArray) + 32;
+
+// ===
+// === Class
+// ============================================================================ //
+
+MissionHistory::MissionHistory(qint64 budget)
+    : _budget(budget)
+    , _size(0)
+    , _step_depth(0)
+    , _is_step_open(false)
+    , _can_coalesce(false)
+{
+}
+
+// Sets the memory budget of the history in bytes. The oldest steps are
+// evicted right away when the history doesn't fit anymore.
+void MissionHistory::setBudget(qint64 budget)
+{
+    _budget = budget;
+    evict();
+}
+
+// Drops all the steps, like when another mission is loaded.
+void MissionHistory::clear()
+{
+    _undo.clear();
+    _redo.clear();
+    _size = 0;
+    _is_step_open = false;
+    _can_coalesce = false;
+}
+
+// Starts grouping the changes recorded into a single step, until the matching
+// call of endStep. The groups may be nested, the outermost one makes the step.
+void MissionHistory::beginStep()
+{
+    _step_depth++;
+}
+
+// Ends grouping the changes recorded into a single step, see beginStep.
+void MissionHistory::endStep()
+{
+    if (_step_depth <= 0 || --_step_depth) return;
+
+    _is_step_open = false;
+    _can_coalesce = false;
+    evict();
+}
+
+// Records the given change, just done on the mission. The changes which could
+// be redone are dropped since they don't apply anymore. The change makes its
+// own step, unless it is coalesced into the last one or a step is grouping
+// the changes (see beginStep).
+void MissionHistory::record(const Change &change)
+{
+    for (const auto &step : _redo) {
+        _size -= sizeOf(step);
+    }
+    _redo.clear();
+
+    if (_step_depth) {
+        if (!_is_step_open) _undo.append(Step());
+        _is_step_open = true;
+        _undo.last().append(change);
+        _size += sizeOf({change});
+        return;
+    }
+
+    if (_can_coalesce && !_undo.isEmpty() && _undo.last().count() == 1) {
+        auto &step = _undo.last();
+        const auto &size = sizeOf(step);
+        if (coalesce(&step.first(), change)) {
+            _size += sizeOf(step) - size;
+            evict();
+            return;
+        }
+    }
+
+    _undo.append({change});
+    _size += sizeOf(_undo.last());
+    _can_coalesce = true;
+    evict();
+}
+
+// Takes the last step done, to be undone. The changes of the step are undone
+// in the reverse order, then the step is given back with pushRedo.
+MissionHistory::Step MissionHistory::takeUndo()
+{
+    if (!canUndo()) return Step();
+
+    const auto step = _undo.takeLast();
+    _size -= sizeOf(step);
+    _can_coalesce = false;
+    return step;
+}
+
+// Takes the last step undone, to be redone. The changes of the step are redone
+// in order, then the step is given back with pushUndo.
+MissionHistory::Step MissionHistory::takeRedo()
+{
+    if (!canRedo()) return Step();
+
+    const auto step = _redo.takeLast();
+    _size -= sizeOf(step);
+    _can_coalesce = false;
+    return step;
+}
+
+// Gives back the given step once redone, it can be undone again.
+void MissionHistory::pushUndo(const Step &step)
+{
+    if (step.isEmpty()) return;
+
+    _undo.append(step);
+    _size += sizeOf(step);
+    evict();
+}
+
+// Gives back the given step once undone, it can be redone again.
+void MissionHistory::pushRedo(const Step &step)
+{
+    if (step.isEmpty()) return;
+
+    _redo.append(step);
+    _size += sizeOf(step);
+    evict();
+}
+
+// Returns the estimated bytes held by the given step.
+qint64 MissionHistory::sizeOf(const Step &step)
+{
+    qint64 size = 0;
+    for (const auto &change : step) {
+        size += ChangeOverhead + change.parent.count() * qint64(sizeof(int));
+        for (const auto &message : change.messages) {
+            size += MessageOverhead + message.size();
+        }
+    }
+    return size;
+}
+
+// Coalesces the given change into the last one, if they are alike, and returns
+// true if so.
+//  - Rows inserted within or right after the rows inserted before still make
+//    a single range of inserted rows.
+//  - Rows removed right before the rows removed before (backward deletion) or
+//    from the same row (forward deletion) were a single range of rows.
+bool MissionHistory::coalesce(Change *last, const Change &change)
+{
+    if (last->type != change.type || last->parent != change.parent) return false;
+
+    if (change.type == Change::kInsert) {
+        if (change.row < last->row || change.row > last->row + last->count) return false;
+        last->count += change.count;
+        return true;
+    }
+
+    if (change.row + change.count == last->row) {
+        last->messages = change.messages + last->messages;
+        last->row = change.row;
+        last->count += change.count;
+        return true;
+    }
+    if (change.row == last->row) {
+        last->messages += change.messages;
+        last->count += change.count;
+        return true;
+    }
+    return false;
+}
+
+// Evicts the steps the farthest from the current mission until the history
+// fits into its budget: the oldest steps done first, then the latest steps
+// undone. The step being grouped is never evicted.
+void MissionHistory::evict()
+{
+    while (_size > _budget) {
+        if (_undo.count() > (_is_step_open ? 1 : 0)) {
+            _size -= sizeOf(_undo.takeFirst());
+        } else if (!_redo.isEmpty()) {
+            _size -= sizeOf(_redo.takeFirst());
+        } else {
+            break;
+        }
+    }
+    if (_undo.isEmpty()) _can_coalesce = false;
+}
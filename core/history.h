@@ -0,0 +1,76 @@
+#ifndef RTSYS_MISSION_HISTORY_H
+#define RTSYS_MISSION_HISTORY_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include <QByteArray>
+#include <QList>
+#include <QVector>
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines the history of the mission edits, so that they can be undone
+// and redone. The history never copies the mission: a change only records
+// where rows were inserted or removed (the row path of their parent from the
+// mission, the first row and their count) and, while the rows are out of the
+// mission, their serialized messages. Undoing an insertion of many rows is
+// then a single range removal and undoing a removal a single range insertion.
+// A step groups the changes undone or redone at once, like the ranges of a
+// removed selection. A change following the one of the last step, same kind
+// on adjacent rows of the same parent, is coalesced into it: points added one
+// after the other are undone at once. The size of the history is kept under a
+// memory budget, the steps the farthest from the current mission are evicted
+// first.
+class MissionHistory
+{
+  public:
+    struct Change {
+        enum Type { kInsert, kRemove };
+
+        Type type;
+        QVector<int> parent;
+        int row;
+        int count;
+        QVector<QByteArray> messages;
+    };
+    typedef QVector<Change> Step;
+
+  public:
+    explicit MissionHistory(qint64 budget = 64 * 1024 * 1024);
+
+    qint64 budget() const { return _budget; }
+    void setBudget(qint64 budget);
+    qint64 size() const { return _size; }
+    bool canUndo() const { return !_undo.isEmpty() && !_is_step_open; }
+    bool canRedo() const { return !_redo.isEmpty() && !_is_step_open; }
+    int undoCount() const { return _undo.count(); }
+    int redoCount() const { return _redo.count(); }
+
+    void clear();
+    void beginStep();
+    void endStep();
+    void record(const Change &change);
+    Step takeUndo();
+    Step takeRedo();
+    void pushUndo(const Step &step);
+    void pushRedo(const Step &step);
+
+  private:
+    static qint64 sizeOf(const Step &step);
+    static bool coalesce(Change *last, const Change &change);
+    void evict();
+
+    QList<Step> _undo;
+    QList<Step> _redo;
+    qint64 _budget;
+    qint64 _size;
+    int _step_depth;
+    bool _is_step_open;
+    bool _can_coalesce;
+};
+
+#endif // RTSYS_MISSION_HISTORY_H
@@ -0,0 +1,202 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/journal.h"
+#include "core/file.h"
+
+#include <QDebug>
+#include <QMutexLocker>
+
+#include <google/protobuf/io/coded_stream.h>
+
+#include <cstring>
+#include <limits>
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The header of the journal: the magic, the version, then the valid size and
+// the checksum of the index of the mission file the journal applies to.
+const char JournalMagic[] = {'R', 'T', 'S', 'J'};
+const quint32 JournalVersion = 1;
+const int JournalHeaderSize = sizeof(JournalMagic) + sizeof(quint32) + sizeof(quint64) + sizeof(quint32);
+
+// The size of the CRC-32 which follows each record.
+const int RecordChecksumSize = sizeof(quint32);
+
+// ===
+// === Class
+// ============================================================================ //
+
+MissionJournal::MissionJournal(QObject *parent)
+    : QThread(parent)
+    , _is_open(false)
+    , _is_stopping(false)
+{
+    setObjectName("MissionJournal");
+}
+
+MissionJournal::~MissionJournal()
+{
+    close();
+}
+
+// Opens the journal specified by the given path, for the mission file of the
+// given valid size and index checksum. When edits are asked for and the journal
+// applies to the file, its edits are read and the next ones are appended after
+// them, otherwise the journal is started over.
+bool MissionJournal::open(const QString &path, qint64 file_size, quint32 file_checksum,
+                          QVector<pb::mission::MissionEdit> *edits)
+{
+    close();
+
+    _file.setFileName(path);
+    if (!_file.open(QIODevice::ReadWrite)) {
+        qWarning() << "MissionJournal" << __func__ << "opening" << path << "fail:" << _file.errorString();
+        return false;
+    }
+
+    auto end = edits ? read(file_size, file_checksum, edits) : 0;
+    if (end) {
+        _file.resize(end);
+    } else {
+        using google::protobuf::io::CodedOutputStream;
+
+        QByteArray header(JournalHeaderSize, Qt::Uninitialized);
+        auto *data = reinterpret_cast<uchar *>(header.data());
+        memcpy(data, JournalMagic, sizeof(JournalMagic));
+        data = CodedOutputStream::WriteLittleEndian32ToArray(JournalVersion, data + sizeof(JournalMagic));
+        data = CodedOutputStream::WriteLittleEndian64ToArray(static_cast<quint64>(file_size), data);
+        CodedOutputStream::WriteLittleEndian32ToArray(file_checksum, data);
+        if (!_file.resize(0) || _file.write(header) != header.size() || !_file.flush() ||
+            !file::sync(_file.handle())) {
+            qWarning() << "MissionJournal" << __func__ << "writing" << path << "fail:" << _file.errorString();
+            _file.close();
+            return false;
+        }
+        end = header.size();
+    }
+    _file.seek(end);
+
+    _is_stopping = false;
+    _is_open = true;
+    start();
+    return true;
+}
+
+// Closes the journal once the records queued are written.
+void MissionJournal::close()
+{
+    if (!_is_open) return;
+
+    {
+        QMutexLocker locker(&_mutex);
+        _is_stopping = true;
+        _condition.wakeOne();
+    }
+    wait();
+    _file.close();
+    _is_open = false;
+}
+
+// Closes the journal and removes its file, the edits it holds are dropped.
+void MissionJournal::discard()
+{
+    if (!_is_open) return;
+
+    close();
+    _file.remove();
+}
+
+// Appends the given edit to the journal. The record is only queued here, the
+// worker writes it.
+void MissionJournal::append(const pb::mission::MissionEdit &edit)
+{
+    if (!_is_open) return;
+
+    using google::protobuf::io::CodedOutputStream;
+
+    const auto &size = static_cast<quint32>(edit.ByteSizeLong());
+    QByteArray record(CodedOutputStream::VarintSize32(size) + size + RecordChecksumSize, Qt::Uninitialized);
+    auto *payload = CodedOutputStream::WriteVarint32ToArray(size, reinterpret_cast<uchar *>(record.data()));
+    edit.SerializeWithCachedSizesToArray(payload);
+    CodedOutputStream::WriteLittleEndian32ToArray(file::crc32(payload, size), payload + size);
+
+    QMutexLocker locker(&_mutex);
+    _records += record;
+    _condition.wakeOne();
+}
+
+// Writes the records queued until the journal is closed. The records queued
+// while the previous ones were written are written and synced to the disk at
+// once, so that a burst of edits costs a single sync.
+void MissionJournal::run()
+{
+    for (;;) {
+        QByteArray records;
+        {
+            QMutexLocker locker(&_mutex);
+            while (_records.isEmpty() && !_is_stopping) {
+                _condition.wait(&_mutex);
+            }
+            if (_records.isEmpty()) return;
+            records.swap(_records);
+        }
+
+        if (_file.write(records) != records.size() || !_file.flush() || !file::sync(_file.handle())) {
+            qWarning() << "MissionJournal" << __func__ << "writing" << _file.fileName()
+                       << "fail:" << _file.errorString();
+        }
+    }
+}
+
+// Reads the edits of the journal, returns the size of its valid part or zero
+// when the journal doesn't apply to the mission file of the given valid size
+// and index checksum. A damaged record, like one torn by a crash, ends the valid
+// part.
+qint64 MissionJournal::read(qint64 file_size, quint32 file_checksum, QVector<pb::mission::MissionEdit> *edits)
+{
+    const auto &size = _file.size();
+    if (size < JournalHeaderSize) return 0;
+
+    auto *data = _file.map(0, size);
+    if (!data) return 0;
+
+    google::protobuf::io::CodedInputStream header(data, JournalHeaderSize);
+    quint32 version = 0;
+    uint64_t journal_file_size = 0;
+    quint32 journal_file_checksum = 0;
+    qint64 end = 0;
+    if (!memcmp(data, JournalMagic, sizeof(JournalMagic)) && header.Skip(sizeof(JournalMagic)) &&
+        header.ReadLittleEndian32(&version) && version == JournalVersion &&
+        header.ReadLittleEndian64(&journal_file_size) && header.ReadLittleEndian32(&journal_file_checksum) &&
+        journal_file_size == static_cast<quint64>(file_size) && journal_file_checksum == file_checksum) {
+        end = JournalHeaderSize;
+        while (end < size) {
+            // A length is a varint32, so it holds in 5 bytes at most.
+            google::protobuf::io::CodedInputStream coded(data + end, static_cast<int>(qMin<qint64>(size - end, 5)));
+            quint32 length = 0;
+            if (!coded.ReadVarint32(&length) || length > static_cast<quint32>(std::numeric_limits<int>::max())) break;
+
+            const auto &start = end + coded.CurrentPosition();
+            if (start + length + RecordChecksumSize > size) break;
+
+            quint32 checksum = 0;
+            google::protobuf::io::CodedInputStream::ReadLittleEndian32FromArray(data + start + length, &checksum);
+            pb::mission::MissionEdit edit;
+            if (checksum != file::crc32(data + start, length) ||
+                !edit.ParseFromArray(data + start, static_cast<int>(length))) {
+                break;
+            }
+            edits->append(edit);
+            end = start + length + RecordChecksumSize;
+        }
+        if (end < size) {
+            qWarning() << "MissionJournal" << __func__ << _file.fileName() << "ends with a damaged record, dropped";
+        }
+    }
+    _file.unmap(data);
+    return end;
+}
@@ -0,0 +1,62 @@
+#ifndef RTSYS_MISSION_JOURNAL_H
+#define RTSYS_MISSION_JOURNAL_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include "protobuf/mission.pb.h"
+
+#include <QByteArray>
+#include <QFile>
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <QVector>
+#include <QWaitCondition>
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines the journal of a mission file. Each edit of the mission is
+// appended to the journal as a length-delimited record followed by its CRC-32,
+// so that the edits made since the file was last saved survive a crash: they
+// are replayed on top of the file when it is opened again. The journal starts
+// with a magic, a version and the identity of the file it applies to (its valid
+// size and the checksum of its index, see file::StreamReader), a journal of
+// another file is discarded.
+// The records are written by a worker thread, appending an edit only queues
+// its record. The worker writes every record queued while it was busy at once
+// and syncs them to the disk once (group commit).
+class MissionJournal : public QThread
+{
+    Q_OBJECT
+
+  public:
+    explicit MissionJournal(QObject *parent = nullptr);
+    ~MissionJournal();
+
+    bool open(const QString &path, qint64 file_size, quint32 file_checksum,
+              QVector<pb::mission::MissionEdit> *edits = nullptr);
+    void close();
+    void discard();
+    bool isOpen() const { return _is_open; }
+    QString fileName() const { return _file.fileName(); }
+    void append(const pb::mission::MissionEdit &edit);
+
+  protected:
+    void run() override;
+
+  private:
+    qint64 read(qint64 file_size, quint32 file_checksum, QVector<pb::mission::MissionEdit> *edits);
+
+    QFile _file;
+    bool _is_open;
+    QMutex _mutex;
+    QWaitCondition _condition;
+    QByteArray _records;
+    bool _is_stopping;
+};
+
+#endif // RTSYS_MISSION_JOURNAL_H
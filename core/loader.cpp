@@ -0,0 +1,227 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/loader.h"
+#include "core/file.h"
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QMutexLocker>
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The duration of the decoding of a batch of components, in milliseconds. It
+// bounds the latency of the progressive insertion, adding a batch into the
+// mission costs a small fraction of its decoding.
+const int BatchDuration = 8;
+
+// The number of elements from which the elements of a collection of an indexed
+// mission file are left in the file, to be loaded once the collection is
+// expanded. The smaller collections are loaded, so that their decoration
+// (route, family, ...) is known right away.
+const int LazyElementCount = 1024;
+
+// ===
+// === Class
+// ============================================================================ //
+
+MissionLoader::MissionLoader(const QString &path, google::protobuf::Arena *arena, QObject *parent)
+    : QThread(parent)
+    , _path(path)
+    , _arena(arena)
+    , _mission(nullptr)
+    , _error(false)
+    , _bytes(0)
+{
+    setObjectName("MissionLoader");
+}
+
+// The reader must be opened (see file::StreamReader::open), the file is read
+// from its first record.
+MissionLoader::MissionLoader(std::shared_ptr<file::StreamReader> stream, google::protobuf::Arena *arena,
+                             QObject *parent)
+    : QThread(parent)
+    , _path(stream->path())
+    , _stream(std::move(stream))
+    , _arena(arena)
+    , _mission(nullptr)
+    , _error(false)
+    , _bytes(0)
+{
+    setObjectName("MissionLoader");
+}
+
+// The source mission is owned by the loader, it is deleted along with it.
+MissionLoader::MissionLoader(std::unique_ptr<const pb::mission::Mission> source, google::protobuf::Arena *arena,
+                             QObject *parent)
+    : QThread(parent)
+    , _source(std::move(source))
+    , _arena(arena)
+    , _mission(nullptr)
+    , _error(false)
+    , _bytes(0)
+{
+    setObjectName("MissionLoader");
+}
+
+MissionLoader::~MissionLoader()
+{
+    requestInterruption();
+    wait();
+}
+
+// Returns the components decoded since the last call, they are no longer
+// held by the loader.
+QVector<pb::mission::Mission::Component *> MissionLoader::takeComponents()
+{
+    QMutexLocker locker(&_mutex);
+    QVector<pb::mission::Mission::Component *> components;
+    components.swap(_components);
+    return components;
+}
+
+// Loads the mission on the worker thread. A streaming mission file is read
+// record by record, a plain mission file is parsed at once and an in-memory
+// mission is copied component by component. A streaming mission file which
+// can't be opened (see file::StreamReader::open) isn't parsed as a plain one.
+void MissionLoader::run()
+{
+    if (_source) {
+        copyMission();
+        return;
+    }
+
+    if (!_stream) {
+        auto stream = std::make_shared<file::StreamReader>(_path);
+        if (!stream->open()) {
+            if (stream->hasError())
+                _error = true;
+            else
+                readFile();
+            return;
+        }
+        _stream = stream;
+    }
+    _reader = _stream;
+    readStream(_stream.get());
+}
+
+// Reads the streaming mission file, the header first then the components in
+// batches, until the end of the file or until the loader is interrupted. When
+// the file is indexed, the components are read through the index and only the
+// name of the large collections is loaded (see isPending).
+void MissionLoader::readStream(file::StreamReader *stream)
+{
+    auto *mission = createMission();
+    if (!stream->readHeader(mission)) {
+        _error = true;
+        return;
+    }
+    _mission = mission;
+    emit missionReady();
+
+    const auto &is_indexed = stream->hasIndex();
+    const auto &count = is_indexed ? stream->index().components_size() : 0;
+    auto done = stream->offset();
+    QVector<pb::mission::Mission::Component *> batch;
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; (is_indexed ? i < count : !stream->atEnd()) && !isInterruptionRequested(); i++) {
+        auto *component = google::protobuf::Arena::CreateMessage<pb::mission::Mission::Component>(_arena);
+        if (is_indexed) {
+            const auto &entry = stream->index().components(i);
+            if (isPending(entry))
+                component->mutable_collection()->set_name(entry.name());
+            else
+                _error = !stream->readComponent(i, component);
+            done = entry.offset() + entry.size();
+        } else {
+            _error = !stream->read(component);
+            done = stream->offset();
+        }
+        if (_error) break;
+
+        batch.append(component);
+        if (timer.elapsed() >= BatchDuration) {
+            push(&batch);
+            emit progress(done, stream->size());
+            timer.restart();
+        }
+    }
+    push(&batch);
+    _bytes = done;
+    emit progress(done, stream->size());
+}
+
+// Parses the plain mission file at once, so it can't be interrupted. The
+// mission is handed out whole, its components are fetched by the model
+// afterwards.
+void MissionLoader::readFile()
+{
+    auto *mission = createMission();
+    if (!file::read(_path, mission, &_bytes)) {
+        _error = true;
+        return;
+    }
+    _mission = mission;
+    emit missionReady();
+    emit progress(_bytes, _bytes);
+}
+
+// Copies the source mission, the header first then the components in batches.
+void MissionLoader::copyMission()
+{
+    _mission = createMission();
+    _mission->set_name(_source->name());
+    emit missionReady();
+
+    QVector<pb::mission::Mission::Component *> batch;
+    QElapsedTimer timer;
+    timer.start();
+    const auto &count = _source->components_size();
+    for (int i = 0; i < count && !isInterruptionRequested(); i++) {
+        auto *component = google::protobuf::Arena::CreateMessage<pb::mission::Mission::Component>(_arena);
+        component->CopyFrom(_source->components(i));
+        batch.append(component);
+        if (timer.elapsed() >= BatchDuration) {
+            push(&batch);
+            emit progress(i + 1, count);
+            timer.restart();
+        }
+    }
+    push(&batch);
+    emit progress(count, count);
+}
+
+// Hands out the given batch of components. The components not yet taken are
+// kept, the signal is emitted only when there was none, so that a slow
+// receiver takes several batches at once.
+void MissionLoader::push(QVector<pb::mission::Mission::Component *> *batch)
+{
+    if (batch->isEmpty()) return;
+
+    bool is_empty;
+    {
+        QMutexLocker locker(&_mutex);
+        is_empty = _components.isEmpty();
+        _components += *batch;
+    }
+    batch->clear();
+    if (is_empty) emit componentsReady();
+}
+
+// Returns true if the elements of the given component of an indexed mission
+// file are left in the file by the loader, to be loaded on demand.
+bool MissionLoader::isPending(const pb::mission::MissionIndex::Component &entry)
+{
+    return entry.element_offsets_size() >= LazyElementCount;
+}
+
+// Returns a new mission allocated on the arena.
+pb::mission::Mission *MissionLoader::createMission()
+{
+    return google::protobuf::Arena::CreateMessage<pb::mission::Mission>(_arena);
+}
@@ -0,0 +1,90 @@
+#ifndef RTSYS_MISSION_LOADER_H
+#define RTSYS_MISSION_LOADER_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include "protobuf/mission.pb.h"
+
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <QVector>
+
+#include <google/protobuf/arena.h>
+
+#include <memory>
+
+namespace file {
+class StreamReader;
+} // namespace file
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines the loader of a mission. The mission is parsed from a file, or
+// copied from another mission, on a worker thread. The messages are allocated
+// on the given arena, which is thread-safe for allocation. The loader owns the
+// mission it copies, so that nothing changes it while the worker reads it.
+// The mission header is handed out first (see missionReady), then its
+// components in batches (see componentsReady and takeComponents). A batch
+// holds the components decoded for a short while, so that the thread owning
+// the mission adds each batch at once without ever waiting for the worker.
+// The mission itself is never touched by the worker once handed out.
+// The reader of a streaming mission file is kept, so that the elements of the
+// large collections of an indexed file, which are left in the file (see
+// isPending), are loaded on demand through the index. A reader already opened
+// may be given instead of a path, the file isn't opened again.
+// The signals are emitted from the worker thread, the loader object lives in
+// the thread which created it. Deleting the loader stops the worker and drops
+// the signals not yet delivered to the slots using the loader as context.
+class MissionLoader : public QThread
+{
+    Q_OBJECT
+
+  public:
+    explicit MissionLoader(const QString &path, google::protobuf::Arena *arena, QObject *parent = nullptr);
+    explicit MissionLoader(std::shared_ptr<file::StreamReader> stream, google::protobuf::Arena *arena,
+                           QObject *parent = nullptr);
+    explicit MissionLoader(std::unique_ptr<const pb::mission::Mission> source, google::protobuf::Arena *arena,
+                           QObject *parent = nullptr);
+    ~MissionLoader();
+
+    pb::mission::Mission *mission() const { return _mission; }
+    QVector<pb::mission::Mission::Component *> takeComponents();
+    bool hasError() const { return _error; }
+    qint64 bytes() const { return _bytes; }
+    std::shared_ptr<const file::StreamReader> reader() const { return _reader; }
+
+    static bool isPending(const pb::mission::MissionIndex::Component &entry);
+
+  signals:
+    void missionReady();
+    void componentsReady();
+    void progress(qint64 done, qint64 total);
+
+  protected:
+    void run() override;
+
+  private:
+    void readStream(file::StreamReader *stream);
+    void readFile();
+    void copyMission();
+    void push(QVector<pb::mission::Mission::Component *> *batch);
+    pb::mission::Mission *createMission();
+
+    const QString _path;
+    std::unique_ptr<const pb::mission::Mission> _source;
+    std::shared_ptr<file::StreamReader> _stream;
+    google::protobuf::Arena *_arena;
+    pb::mission::Mission *_mission;
+    QMutex _mutex;
+    QVector<pb::mission::Mission::Component *> _components;
+    std::shared_ptr<const file::StreamReader> _reader;
+    bool _error;
+    qint64 _bytes;
+};
+
+#endif // RTSYS_MISSION_LOADER_H
@@ -0,0 +1,375 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/merge.h"
+#include "core/diff.h"
+
+#include <QHash>
+
+#include <algorithm>
+#include <string>
+
+// ===
+// === Define
+// ============================================================================ //
+
+namespace mission {
+
+// The paths of the parents of the rows merged at once, in the base, ours and
+// theirs missions.
+struct Parents {
+    QVector<int> base;
+    QVector<int> ours;
+    QVector<int> theirs;
+};
+
+// A row placed by theirs into the merged rows: after the given row of ours, -1
+// for the first rows. The row is either a row of ours moved by theirs, a row
+// ours inserted after it, or a row inserted by theirs.
+struct Placement {
+    int slot;
+    int ours_row;
+    int theirs_row;
+};
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns the given parent path followed by the given row, an empty path when
+// the row is -1.
+static QVector<int> pathOf(const QVector<int> &parent, int row)
+{
+    if (row < 0) return QVector<int>();
+
+    auto path = parent;
+    path.append(row);
+    return path;
+}
+
+// Returns the conflict of the given type on the given rows.
+static MergeConflict conflictOf(MergeConflict::Type type, MergeConflict::Field field, const Parents &parents,
+                                int base_row, int ours_row, int theirs_row)
+{
+    return {type, field, pathOf(parents.base, base_row), pathOf(parents.ours, ours_row),
+            pathOf(parents.theirs, theirs_row)};
+}
+
+// Returns the parent paths of the children of the given rows.
+static Parents parentsOf(const Parents &parents, int base_row, int ours_row, int theirs_row)
+{
+    return {pathOf(parents.base, base_row), pathOf(parents.ours, ours_row), pathOf(parents.theirs, theirs_row)};
+}
+
+// Merges the given field of theirs into ours, given its base: the field of
+// ours is only set, with the given function, when theirs changed it. Returns
+// false if both changed it differently, ours being kept.
+template <class Set>
+static bool mergeField(const std::string &base, const std::string &theirs, const std::string &ours, Set set)
+{
+    if (theirs == base || theirs == ours) return true;
+    if (ours != base) return false;
+
+    set(theirs);
+    return true;
+}
+
+// Merges the given rail or segment of theirs into ours, given its base: its
+// name and its points.
+template <class Line>
+static void mergeLine(const Line &base, const Line &theirs, Line *ours, const Parents &parents, int base_row,
+                      int ours_row, int theirs_row, QVector<MergeConflict> *conflicts)
+{
+    if (!mergeField(base.name(), theirs.name(), ours->name(),
+                    [&](const std::string &name) { ours->set_name(name); })) {
+        conflicts->append(conflictOf(MergeConflict::kChange, MergeConflict::kName, parents, base_row, ours_row,
+                                     theirs_row));
+    }
+    if (!mergeField(base.p0().name(), theirs.p0().name(), ours->p0().name(),
+                    [&](const std::string &name) { ours->mutable_p0()->set_name(name); })) {
+        conflicts->append(conflictOf(MergeConflict::kChange, MergeConflict::kFirstPoint, parents, base_row, ours_row,
+                                     theirs_row));
+    }
+    if (!mergeField(base.p1().name(), theirs.p1().name(), ours->p1().name(),
+                    [&](const std::string &name) { ours->mutable_p1()->set_name(name); })) {
+        conflicts->append(conflictOf(MergeConflict::kChange, MergeConflict::kSecondPoint, parents, base_row,
+                                     ours_row, theirs_row));
+    }
+}
+
+// Merges the given element of theirs into ours, given its base, field by
+// field. The rows are matched by type, but an element may still have changed
+// its type on both sides.
+static void mergeElement(const pb::mission::Mission::Element &base, const pb::mission::Mission::Element &theirs,
+                         pb::mission::Mission::Element *ours, const Parents &parents, int base_row, int ours_row,
+                         int theirs_row, QVector<MergeConflict> *conflicts)
+{
+    const auto &type = componentTypeOf(base);
+    if (componentTypeOf(theirs) != type || componentTypeOf(*ours) != type) {
+        conflicts->append(conflictOf(MergeConflict::kChange, MergeConflict::kElement, parents, base_row, ours_row,
+                                     theirs_row));
+        return;
+    }
+
+    if (type == kPoint) {
+        if (!mergeField(base.point().name(), theirs.point().name(), ours->point().name(),
+                        [&](const std::string &name) { ours->mutable_point()->set_name(name); })) {
+            conflicts->append(conflictOf(MergeConflict::kChange, MergeConflict::kName, parents, base_row, ours_row,
+                                         theirs_row));
+        }
+    } else if (type == kRail) {
+        mergeLine(base.rail(), theirs.rail(), ours->mutable_rail(), parents, base_row, ours_row, theirs_row,
+                  conflicts);
+    } else if (type == kSegment) {
+        mergeLine(base.segment(), theirs.segment(), ours->mutable_segment(), parents, base_row, ours_row, theirs_row,
+                  conflicts);
+    }
+}
+
+// Merges the given rows of theirs into the rows of ours, given their base.
+//  - The rows kept by both and changed by theirs are merged by the content
+//    function, or copied when ours didn't change them.
+//  - The rows removed by theirs are removed, unless changed by ours.
+//  - The rows inserted by theirs, or moved by theirs only, are placed after
+//    the row of ours they follow in theirs, and after the rows ours inserted
+//    there. The rows ours inserted after a row moved by theirs move with it.
+//    The rows inserted by both at the same place are only kept once.
+// The rows of ours are reordered in place, only the rows inserted by theirs
+// are copied. Nothing is done when theirs didn't change the rows.
+template <class Message, class Content>
+static void mergeRows(const google::protobuf::RepeatedPtrField<Message> &base,
+                      const google::protobuf::RepeatedPtrField<Message> &theirs,
+                      google::protobuf::RepeatedPtrField<Message> *ours, const Parents &parents, Content content,
+                      QVector<MergeConflict> *conflicts)
+{
+    const auto &base_rows = rowsOf(base);
+    const auto &theirs_rows = rowsOf(theirs);
+    auto is_same = base_rows.count() == theirs_rows.count();
+    for (int i = 0; i < base_rows.count() && is_same; i++) {
+        is_same = base_rows.at(i).hash == theirs_rows.at(i).hash;
+    }
+    if (is_same) return;
+
+    const auto &ours_rows = rowsOf(*ours);
+    const auto &ours_matching = matchRows(base_rows, ours_rows);
+    const auto &theirs_matching = matchRows(base_rows, theirs_rows);
+
+    QVector<bool> is_removed(ours_rows.count(), false);
+    for (int b = 0; b < base_rows.count(); b++) {
+        const auto &o = ours_matching.new_rows.at(b);
+        const auto &t = theirs_matching.new_rows.at(b);
+        const auto &is_ours_changed = o >= 0 && ours_rows.at(o).hash != base_rows.at(b).hash;
+        const auto &is_theirs_changed = t >= 0 && theirs_rows.at(t).hash != base_rows.at(b).hash;
+        if (o < 0) {
+            if (is_theirs_changed) conflicts->append(conflictOf(MergeConflict::kRemove, MergeConflict::kNoField,
+                                                                parents, b, o, t));
+        } else if (t < 0) {
+            if (is_ours_changed)
+                conflicts->append(conflictOf(MergeConflict::kRemove, MergeConflict::kNoField, parents, b, o, t));
+            else
+                is_removed[o] = true;
+        } else if (is_theirs_changed && ours_rows.at(o).hash != theirs_rows.at(t).hash) {
+            if (!is_ours_changed && ours_rows.at(o).type != kCollection)
+                ours->Mutable(o)->CopyFrom(theirs.Get(t));
+            else
+                content(b, o, t);
+        }
+    }
+
+    // The rows inserted by ours are looked up by their hash and the row they
+    // follow, and the base row each row of ours follows is kept to tell where
+    // ours moved a row. The slot of a row of ours is the last row inserted by
+    // ours right after it, the row itself otherwise.
+    QMultiHash<quint64, int> ours_inserted;
+    QVector<int> ours_previous(ours_rows.count(), -1);
+    QVector<int> ours_slots(ours_rows.count() + 1);
+    for (int o = 0, anchor = -1, previous = -1; o < ours_rows.count(); o++) {
+        ours_previous[o] = previous;
+        if (ours_matching.old_rows.at(o) >= 0) {
+            anchor = o;
+            previous = ours_matching.old_rows.at(o);
+        } else {
+            ours_inserted.insert(ours_rows.at(o).hash, anchor);
+        }
+    }
+    for (int o = ours_rows.count() - 1; o >= -1; o--) {
+        const auto &is_inserted = o + 1 < ours_rows.count() && ours_matching.old_rows.at(o + 1) < 0;
+        ours_slots[o + 1] = is_inserted ? ours_slots.at(o + 2) : o;
+    }
+
+    // The anchor is the row of ours the next row of theirs follows, and the
+    // slot where that row goes: a row moved by theirs takes the slot of the
+    // row it follows, so the rows after it are placed from its final place.
+    QVector<bool> is_placed(ours_rows.count(), false);
+    QVector<Placement> placements;
+    for (int t = 0, anchor = -1, slot = ours_slots.at(0), previous = -1; t < theirs_rows.count(); t++) {
+        const auto &b = theirs_matching.old_rows.at(t);
+        if (b < 0) {
+            if (!ours_inserted.contains(theirs_rows.at(t).hash, anchor)) {
+                placements.append({slot, -1, t});
+            }
+            continue;
+        }
+
+        const auto theirs_previous = previous;
+        previous = b;
+        const auto &o = ours_matching.new_rows.at(b);
+        if (o < 0) continue;
+
+        if (theirs_matching.is_moved.at(t)) {
+            if (!ours_matching.is_moved.at(o)) {
+                for (auto i = o; i <= ours_slots.at(o + 1); i++) {
+                    is_placed[i] = true;
+                    placements.append({slot, i, -1});
+                }
+                anchor = o;
+                continue;
+            }
+            if (ours_previous.at(o) != theirs_previous) {
+                conflicts->append(conflictOf(MergeConflict::kMove, MergeConflict::kNoField, parents, b, o, t));
+            }
+        }
+        anchor = o;
+        slot = ours_slots.at(o + 1);
+    }
+    if (placements.isEmpty() && !is_removed.contains(true)) return;
+
+    // The rows are given their merged order by swapping the pointers of ours,
+    // the rows removed are moved to the end then deleted.
+    std::stable_sort(placements.begin(), placements.end(),
+                     [](const Placement &a, const Placement &b) { return a.slot < b.slot; });
+    QVector<Message *> order;
+    QVector<Message *> removed;
+    order.reserve(ours_rows.count() + placements.count());
+    auto next = 0;
+    for (int o = -1; o < ours_rows.count(); o++) {
+        if (o >= 0 && is_removed.at(o)) {
+            removed.append(ours->Mutable(o));
+        } else if (o >= 0 && !is_placed.at(o)) {
+            order.append(ours->Mutable(o));
+        }
+        for (; next < placements.count() && placements.at(next).slot == o; next++) {
+            const auto &placement = placements.at(next);
+            if (placement.ours_row >= 0) {
+                order.append(ours->Mutable(placement.ours_row));
+            } else {
+                auto *message = ours->Add();
+                message->CopyFrom(theirs.Get(placement.theirs_row));
+                order.append(message);
+            }
+        }
+    }
+
+    auto it = ours->pointer_begin();
+    for (auto *message : order) {
+        *it++ = message;
+    }
+    for (auto *message : removed) {
+        *it++ = message;
+    }
+    ours->DeleteSubrange(order.count(), removed.count());
+}
+
+// Merges the given component of theirs into ours, given its base: the name and
+// the elements of a collection, an element otherwise.
+static void mergeComponent(const pb::mission::Mission::Component &base,
+                           const pb::mission::Mission::Component &theirs, pb::mission::Mission::Component *ours,
+                           const Parents &parents, int base_row, int ours_row, int theirs_row,
+                           QVector<MergeConflict> *conflicts)
+{
+    if (!base.has_collection()) {
+        mergeElement(base.element(), theirs.element(), ours->mutable_element(), parents, base_row, ours_row,
+                     theirs_row, conflicts);
+        return;
+    }
+
+    const auto &collection = base.collection();
+    auto *ours_collection = ours->mutable_collection();
+    if (!mergeField(collection.name(), theirs.collection().name(), ours_collection->name(),
+                    [&](const std::string &name) { ours_collection->set_name(name); })) {
+        conflicts->append(conflictOf(MergeConflict::kChange, MergeConflict::kName, parents, base_row, ours_row,
+                                     theirs_row));
+    }
+
+    const auto &element_parents = parentsOf(parents, base_row, ours_row, theirs_row);
+    mergeRows(
+        collection.elements(), theirs.collection().elements(), ours_collection->mutable_elements(), element_parents,
+        [&](int b, int o, int t) {
+            mergeElement(collection.elements(b), theirs.collection().elements(t),
+                         ours_collection->mutable_elements(o), element_parents, b, o, t, conflicts);
+        },
+        conflicts);
+}
+
+// Merges the edits of theirs into ours, given the base mission both were
+// edited from, and returns the conflicts. The components, then the elements
+// of the collections, are matched against the base by their hash first (see
+// diff), so that the rows theirs didn't change are never walked again: a
+// collection is only merged when theirs changed it, and the rows of ours are
+// only reordered where theirs inserted, moved or removed rows. The rows kept
+// by both are merged field by field. On a conflict, ours is kept.
+QVector<MergeConflict> merge(const pb::mission::Mission &base, const pb::mission::Mission &theirs,
+                             pb::mission::Mission *ours)
+{
+    QVector<MergeConflict> conflicts;
+    if (!mergeField(base.name(), theirs.name(), ours->name(),
+                    [&](const std::string &name) { ours->set_name(name); })) {
+        conflicts.append({MergeConflict::kChange, MergeConflict::kName, {}, {}, {}});
+    }
+
+    const Parents parents;
+    mergeRows(
+        base.components(), theirs.components(), ours->mutable_components(), parents,
+        [&](int b, int o, int t) {
+            mergeComponent(base.components(b), theirs.components(t), ours->mutable_components(o), parents, b, o, t,
+                           &conflicts);
+        },
+        &conflicts);
+    return conflicts;
+}
+
+// Returns the given path as text, the rows separated by slashes, or a dash
+// when the row was removed.
+static QString toString(const QVector<int> &path)
+{
+    if (path.isEmpty()) return "-";
+
+    QStringList rows;
+    for (const auto &row : path) {
+        rows.append(QString::number(row));
+    }
+    return rows.join('/');
+}
+
+// Returns the given conflicts as text, one line per conflict.
+QStringList describe(const QVector<MergeConflict> &conflicts)
+{
+    static const char *const FieldNames[] = {"name", "first point", "second point", "element type", ""};
+
+    QStringList lines;
+    for (const auto &conflict : conflicts) {
+        if (conflict.base_path.isEmpty()) {
+            lines.append(QString("both changed the %1 of the mission").arg(FieldNames[conflict.field]));
+            continue;
+        }
+
+        const auto &paths = QString(" base %1 (ours %2, theirs %3)")
+                                .arg(toString(conflict.base_path), toString(conflict.ours_path),
+                                     toString(conflict.theirs_path));
+        switch (conflict.type) {
+            case MergeConflict::kChange:
+                lines.append(QString("both changed the %1 of").arg(FieldNames[conflict.field]) + paths);
+                break;
+            case MergeConflict::kRemove:
+                lines.append("removed and changed" + paths);
+                break;
+            case MergeConflict::kMove:
+                lines.append("both moved" + paths);
+                break;
+        }
+    }
+    return lines;
+}
+
+} // namespace mission
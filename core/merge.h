@@ -0,0 +1,49 @@
+#ifndef RTSYS_MISSION_MERGE_H
+#define RTSYS_MISSION_MERGE_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include "protobuf/mission.pb.h"
+
+#include <QStringList>
+#include <QVector>
+
+// ===
+// === Define
+// ============================================================================ //
+
+namespace mission {
+
+// A conflict of a three-way merge: ours and theirs edited the same row in ways
+// which can't be both applied, the merged mission keeps the row of ours. The
+// row is given by its path in the base, ours and theirs missions (see
+// DiffEdit), a path being empty where the row was removed. The conflicts on
+// the mission itself have no path at all.
+//  - Change: both changed the given field of the row differently, the element
+//    field telling that both changed the type of the element.
+//  - Remove: one removed the row, the other changed it.
+//  - Move: both moved the row, to different places.
+struct MergeConflict {
+    enum Type { kChange, kRemove, kMove };
+    enum Field { kName, kFirstPoint, kSecondPoint, kElement, kNoField };
+
+    Type type;
+    Field field;
+    QVector<int> base_path;
+    QVector<int> ours_path;
+    QVector<int> theirs_path;
+};
+
+// ===
+// === Function
+// ============================================================================ //
+
+QVector<MergeConflict> merge(const pb::mission::Mission &base, const pb::mission::Mission &theirs,
+                             pb::mission::Mission *ours);
+QStringList describe(const QVector<MergeConflict> &conflicts);
+
+} // namespace mission
+
+#endif // RTSYS_MISSION_MERGE_H
@@ -0,0 +1,335 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/mission.h"
+
+#include <QDebug>
+
+#include <algorithm>
+
+// ===
+// === Function
+// ============================================================================ //
+
+namespace mission {
+
+// Returns the component type of the given protobuf message.
+// The component type is figured out by comparing the protobuf message
+// descriptor against the generated descriptors. Descriptors are singletons
+// so the comparison is done on pointers and never on descriptor names.
+Component componentTypeOf(const google::protobuf::Message *protobuf)
+{
+    if (!protobuf) return kNoComponent;
+
+    const auto *descriptor = protobuf->GetDescriptor();
+    if (descriptor == pb::mission::Mission::descriptor()) return kMission;
+    if (descriptor == pb::mission::Mission::Collection::descriptor()) return kCollection;
+    if (descriptor == pb::mission::Mission::Element::Point::descriptor()) return kPoint;
+    if (descriptor == pb::mission::Mission::Element::Rail::descriptor()) return kRail;
+    if (descriptor == pb::mission::Mission::Element::Segment::descriptor()) return kSegment;
+    return kNoComponent;
+}
+
+// Returns the component type of the given mission element.
+Component componentTypeOf(const pb::mission::Mission::Element &element)
+{
+    switch (element.element_case()) {
+        case pb::mission::Mission::Element::kPoint:
+            return kPoint;
+        case pb::mission::Mission::Element::kRail:
+            return kRail;
+        case pb::mission::Mission::Element::kSegment:
+            return kSegment;
+        default:
+            return kNoComponent;
+    }
+}
+
+// Returns the component type of the given mission component.
+Component componentTypeOf(const pb::mission::Mission::Component &component)
+{
+    switch (component.component_case()) {
+        case pb::mission::Mission::Component::kElement:
+            return componentTypeOf(component.element());
+        case pb::mission::Mission::Component::kCollection:
+            return kCollection;
+        default:
+            return kNoComponent;
+    }
+}
+
+// Returns the collection type of the given collection.
+//  - A Route is a collection of Point.
+//  - A Family is a collection of Rail.
+Collection collectionTypeOf(const pb::mission::Mission::Collection &collection)
+{
+    auto points = 0;
+    auto rails = 0;
+    for (const auto &element : collection.elements()) {
+        const auto &component_type = componentTypeOf(element);
+        points += component_type == kPoint;
+        rails += component_type == kRail;
+    }
+    if (points == collection.elements_size()) return kRoute;
+    if (rails == collection.elements_size()) return kFamily;
+    return kScenario;
+}
+
+// Returns the name of the given protobuf message of the given component type.
+// The name is returned by reference so that nothing is copied nor converted.
+const std::string &nameOf(const google::protobuf::Message *protobuf, Component component)
+{
+    static const std::string no_name;
+
+    if (component == kMission) {
+        return static_cast<const pb::mission::Mission *>(protobuf)->name();
+    } else if (component == kCollection) {
+        return static_cast<const pb::mission::Mission::Collection *>(protobuf)->name();
+    } else if (component == kPoint) {
+        return static_cast<const pb::mission::Mission::Element::Point *>(protobuf)->name();
+    } else if (component == kRail) {
+        return static_cast<const pb::mission::Mission::Element::Rail *>(protobuf)->name();
+    } else if (component == kSegment) {
+        return static_cast<const pb::mission::Mission::Element::Segment *>(protobuf)->name();
+    }
+    return no_name;
+}
+
+// Returns the number of children of the given protobuf message of the given
+// component type.
+int childCountOf(const google::protobuf::Message *protobuf, Component component)
+{
+    if (component == kMission) {
+        return static_cast<const pb::mission::Mission *>(protobuf)->components_size();
+    } else if (component == kCollection) {
+        return static_cast<const pb::mission::Mission::Collection *>(protobuf)->elements_size();
+    } else if (component == kRail || component == kSegment) {
+        return 2; // p0 and p1
+    }
+    return 0;
+}
+
+// Adds a point under the given parent protobuf message of the given component
+// type. Depending on the component type, the point is added either into the
+// mission components or the collection elements.
+pb::mission::Mission::Element::Point *addPoint(google::protobuf::Message *parent, Component component)
+{
+    if (component == kMission) {
+        return static_cast<pb::mission::Mission *>(parent)->add_components()->mutable_element()->mutable_point();
+    } else if (component == kCollection) {
+        return static_cast<pb::mission::Mission::Collection *>(parent)->add_elements()->mutable_point();
+    }
+    qWarning() << "mission" << __func__ << "adding point not implemented for component type" << component;
+    return nullptr;
+}
+
+// Adds a rail under the given parent protobuf message of the given component
+// type. Depending on the component type, the rail is added either into the
+// mission components or the collection elements.
+pb::mission::Mission::Element::Rail *addRail(google::protobuf::Message *parent, Component component)
+{
+    if (component == kMission) {
+        return static_cast<pb::mission::Mission *>(parent)->add_components()->mutable_element()->mutable_rail();
+    } else if (component == kCollection) {
+        return static_cast<pb::mission::Mission::Collection *>(parent)->add_elements()->mutable_rail();
+    }
+    qWarning() << "mission" << __func__ << "adding rail not implemented for component type" << component;
+    return nullptr;
+}
+
+// Removes the 'count' children starting at 'row' of the given parent protobuf
+// message of the given component type. The whole range is deleted at once,
+// the following children are shifted only once whatever the size of the range.
+bool remove(google::protobuf::Message *parent, Component component, int row, int count)
+{
+    if (component == kMission) {
+        auto *mission = static_cast<pb::mission::Mission *>(parent);
+        if (row < 0 || count <= 0 || row + count > mission->components_size()) return false;
+        mission->mutable_components()->DeleteSubrange(row, count);
+        return true;
+    } else if (component == kCollection) {
+        auto *collection = static_cast<pb::mission::Mission::Collection *>(parent);
+        if (row < 0 || count <= 0 || row + count > collection->elements_size()) return false;
+        collection->mutable_elements()->DeleteSubrange(row, count);
+        return true;
+    }
+    qWarning() << "mission" << __func__ << "removing not implemented for component type" << component;
+    return false;
+}
+
+// Returns the 'count' children starting at 'row' of the given parent protobuf
+// message of the given component type, serialized one by one, so that they
+// can be inserted again later on (see insert).
+QVector<QByteArray> serialize(const google::protobuf::Message *parent, Component component, int row, int count)
+{
+    QVector<QByteArray> messages;
+    if (component != kMission && component != kCollection) {
+        qWarning() << "mission" << __func__ << "serializing not implemented for component type" << component;
+        return messages;
+    }
+    if (row < 0 || count <= 0 || row + count > childCountOf(parent, component)) return messages;
+
+    messages.reserve(count);
+    for (int i = row; i < row + count; i++) {
+        const google::protobuf::Message *child = nullptr;
+        if (component == kMission) {
+            child = &static_cast<const pb::mission::Mission *>(parent)->components(i);
+        } else {
+            child = &static_cast<const pb::mission::Mission::Collection *>(parent)->elements(i);
+        }
+        QByteArray message(static_cast<int>(child->ByteSizeLong()), Qt::Uninitialized);
+        child->SerializeWithCachedSizesToArray(reinterpret_cast<quint8 *>(message.data()));
+        messages.append(message);
+    }
+    return messages;
+}
+
+// Parses the given serialized messages at the end of the given repeated field,
+// then rotates them into place from 'row' on. The following children are
+// shifted only once whatever the number of messages.
+template <class T>
+static bool insertInto(google::protobuf::RepeatedPtrField<T> *repeated, int row,
+                       const QVector<QByteArray> &messages)
+{
+    if (row < 0 || row > repeated->size()) return false;
+
+    const auto &size = repeated->size();
+    repeated->Reserve(size + messages.count());
+    for (const auto &message : messages) {
+        if (!repeated->Add()->ParseFromArray(message.constData(), message.size())) {
+            repeated->DeleteSubrange(size, repeated->size() - size);
+            return false;
+        }
+    }
+    std::rotate(repeated->pointer_begin() + row, repeated->pointer_begin() + size, repeated->pointer_end());
+    return true;
+}
+
+// Inserts the given serialized messages (see serialize) at 'row' under the
+// given parent protobuf message of the given component type. The messages are
+// allocated on the arena of the parent, if any. Nothing is inserted when one
+// of the messages can't be parsed.
+bool insert(google::protobuf::Message *parent, Component component, int row, const QVector<QByteArray> &messages)
+{
+    if (component == kMission) {
+        return insertInto(static_cast<pb::mission::Mission *>(parent)->mutable_components(), row, messages);
+    } else if (component == kCollection) {
+        return insertInto(static_cast<pb::mission::Mission::Collection *>(parent)->mutable_elements(), row,
+                          messages);
+    }
+    qWarning() << "mission" << __func__ << "inserting not implemented for component type" << component;
+    return false;
+}
+
+// Adds the counts of the other stats to these ones.
+Stats &Stats::operator+=(const Stats &other)
+{
+    components += other.components;
+    collections += other.collections;
+    scenarios += other.scenarios;
+    routes += other.routes;
+    families += other.families;
+    points += other.points;
+    rails += other.rails;
+    segments += other.segments;
+    return *this;
+}
+
+// Counts the given element into the given stats.
+static void countElement(const pb::mission::Mission::Element &element, Stats *stats)
+{
+    const auto &component_type = componentTypeOf(element);
+    stats->points += component_type == kPoint;
+    stats->rails += component_type == kRail;
+    stats->segments += component_type == kSegment;
+}
+
+// Returns the stats of the given mission.
+Stats statsOf(const pb::mission::Mission &mission)
+{
+    Stats stats;
+    stats.components = mission.components_size();
+    for (const auto &component : mission.components()) {
+        if (component.has_element()) {
+            countElement(component.element(), &stats);
+        } else if (component.has_collection()) {
+            const auto &collection = component.collection();
+            for (const auto &element : collection.elements()) {
+                countElement(element, &stats);
+            }
+
+            const auto &collection_type = collectionTypeOf(collection);
+            stats.collections++;
+            stats.scenarios += collection_type == kScenario;
+            stats.routes += collection_type == kRoute;
+            stats.families += collection_type == kFamily;
+        }
+    }
+    return stats;
+}
+
+// Checks the given element, the problems found are appended to the given list
+// under the given location.
+static void validateElement(const pb::mission::Mission::Element &element, const QString &location,
+                            QStringList *problems)
+{
+    const auto &component_type = componentTypeOf(element);
+    if (component_type == kNoComponent) {
+        problems->append(location + " is empty");
+        return;
+    }
+
+    const google::protobuf::Message *protobuf = &element.point();
+    if (component_type == kRail) {
+        protobuf = &element.rail();
+        if (!element.rail().has_p0() || !element.rail().has_p1()) problems->append(location + " misses a point");
+    } else if (component_type == kSegment) {
+        protobuf = &element.segment();
+        if (!element.segment().has_p0() || !element.segment().has_p1()) {
+            problems->append(location + " misses a point");
+        }
+    }
+    if (nameOf(protobuf, component_type).empty()) problems->append(location + " has no name");
+}
+
+// Returns the problems of the given mission, the checking stops once the given
+// number of problems is found. The mission is valid when the list is empty.
+//  - Every component and element holds a message.
+//  - Every rail and segment holds both its points.
+//  - The mission, its collections and its elements are named.
+QStringList validate(const pb::mission::Mission &mission, int max_problems)
+{
+    QStringList problems;
+    if (mission.name().empty()) problems.append("mission has no name");
+
+    for (int i = 0; i < mission.components_size() && problems.count() < max_problems; i++) {
+        const auto &component = mission.components(i);
+        const auto &location = QString("component %1").arg(i);
+        if (component.has_element()) {
+            validateElement(component.element(), location, &problems);
+        } else if (component.has_collection()) {
+            const auto &collection = component.collection();
+            if (collection.name().empty()) problems.append(location + " has no name");
+            for (int j = 0; j < collection.elements_size() && problems.count() < max_problems; j++) {
+                validateElement(collection.elements(j), location + QString(" element %1").arg(j), &problems);
+            }
+        } else {
+            problems.append(location + " is empty");
+        }
+    }
+    return problems.mid(0, max_problems);
+}
+
+// Returns the options of the mission arenas, of the manager and of the batch
+// tools alike. The arenas grow by large blocks since a mission may hold
+// millions of messages.
+google::protobuf::ArenaOptions arenaOptions()
+{
+    google::protobuf::ArenaOptions options;
+    options.start_block_size = 64 * 1024;
+    options.max_block_size = 4 * 1024 * 1024;
+    return options;
+}
+
+} // namespace mission
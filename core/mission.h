@@ -0,0 +1,68 @@
+#ifndef RTSYS_MISSION_MISSION_H
+#define RTSYS_MISSION_MISSION_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include "protobuf/mission.pb.h"
+
+#include <QByteArray>
+#include <QStringList>
+#include <QVector>
+
+#include <google/protobuf/arena.h>
+
+#include <string>
+
+// ===
+// === Function
+// ============================================================================ //
+
+// This defines the headless mission API: the structure of the protobuf mission
+// (the component type of each message, its name and its children) and its
+// mutations. Nothing here depends on the model nor on the gui, so that the
+// batch tools work on the protobuf mission straight away. The model adapter
+// (see MissionBackend) builds on it.
+namespace mission {
+
+enum Component : unsigned char { kMission, kCollection, kPoint, kRail, kSegment, kNoComponent };
+enum Collection { kScenario, kRoute, kFamily };
+
+// The number of messages of a mission, by component and collection type. The
+// points of the rails and segments aren't counted as points.
+struct Stats {
+    qint64 components = 0;
+    qint64 collections = 0;
+    qint64 scenarios = 0;
+    qint64 routes = 0;
+    qint64 families = 0;
+    qint64 points = 0;
+    qint64 rails = 0;
+    qint64 segments = 0;
+
+    Stats &operator+=(const Stats &other);
+};
+
+Component componentTypeOf(const google::protobuf::Message *protobuf);
+Component componentTypeOf(const pb::mission::Mission::Element &element);
+Component componentTypeOf(const pb::mission::Mission::Component &component);
+Collection collectionTypeOf(const pb::mission::Mission::Collection &collection);
+
+const std::string &nameOf(const google::protobuf::Message *protobuf, Component component);
+int childCountOf(const google::protobuf::Message *protobuf, Component component);
+
+pb::mission::Mission::Element::Point *addPoint(google::protobuf::Message *parent, Component component);
+pb::mission::Mission::Element::Rail *addRail(google::protobuf::Message *parent, Component component);
+bool remove(google::protobuf::Message *parent, Component component, int row, int count);
+QVector<QByteArray> serialize(const google::protobuf::Message *parent, Component component, int row, int count);
+bool insert(google::protobuf::Message *parent, Component component, int row, const QVector<QByteArray> &messages);
+
+Stats statsOf(const pb::mission::Mission &mission);
+QStringList validate(const pb::mission::Mission &mission, int max_problems = 100);
+
+google::protobuf::ArenaOptions arenaOptions();
+
+} // namespace mission
+
+#endif // RTSYS_MISSION_MISSION_H
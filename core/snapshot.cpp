@@ -0,0 +1,187 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/snapshot.h"
+
+#include <QHash>
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns true if a chunk of a shared list ends with the given source. The ends
+// only depend on the address of the sources, so that the chunks after an
+// insertion or a removal keep the same sources and are still shared.
+static bool isChunkEnd(const void *source)
+{
+    const auto &hash = static_cast<quint64>(reinterpret_cast<quintptr>(source) >> 3) * Q_UINT64_C(0x9E3779B97F4A7C15);
+    return (hash >> 32) % SharedChunkSize == 0;
+}
+
+// ===
+// === Class
+// ============================================================================ //
+
+// Copies the snapshot into the given protobuf mission, which is cleared first.
+// The copy is a regular protobuf mission, it doesn't share anything.
+void MissionSnapshot::copyTo(pb::mission::Mission *mission) const
+{
+    mission->Clear();
+    mission->set_name(_name);
+    auto *components = mission->mutable_components();
+    components->Reserve(_components.count());
+    for (int i = 0; i < _components.count(); i++) {
+        const auto &component = _components.at(i);
+        if (!component.isCollection()) {
+            components->Add()->mutable_element()->CopyFrom(*component.element);
+            continue;
+        }
+
+        auto *collection = components->Add()->mutable_collection();
+        collection->set_name(component.name);
+        collection->mutable_elements()->Reserve(component.elements.count());
+        for (int j = 0; j < component.elements.chunkCount(); j++) {
+            for (const auto &element : component.elements.chunk(j).items) {
+                collection->add_elements()->CopyFrom(*element);
+            }
+        }
+    }
+}
+
+// ============================================================================ //
+
+// Takes the snapshot of the given mission. The chunks and components of the
+// last snapshot are shared by the new one when unchanged, then the new one
+// becomes the last snapshot.
+MissionSnapshot MissionSnapshotBuilder::take(const pb::mission::Mission &mission)
+{
+    MissionSnapshot snapshot;
+    snapshot._is_valid = true;
+    snapshot._name = mission.name();
+    snapshot._components = share(mission.components(), _last._components,
+                                 [this](const pb::mission::Mission::Component &component,
+                                        const MissionSnapshot::Component *previous) {
+                                     return copyComponent(component, previous);
+                                 });
+    _touched.clear();
+    _last = snapshot;
+    return snapshot;
+}
+
+// Tells that the elements of the given protobuf collection changed since the
+// last snapshot, it is copied again by the next one. Its elements which didn't
+// change are still shared.
+void MissionSnapshotBuilder::touch(const google::protobuf::Message *collection)
+{
+    _touched.insert(collection);
+}
+
+// Forgets the last snapshot, like when another mission replaces the mission.
+// The next snapshot is a whole copy of the mission.
+void MissionSnapshotBuilder::clear()
+{
+    _last = MissionSnapshot();
+    _touched.clear();
+}
+
+// Returns the copy of the given protobuf component. The elements of a
+// collection are shared with its previous copy, if any, when unchanged.
+std::shared_ptr<const MissionSnapshot::Component> MissionSnapshotBuilder::copyComponent(
+    const pb::mission::Mission::Component &component, const MissionSnapshot::Component *previous)
+{
+    static const SharedList<MissionSnapshot::Element> no_elements;
+
+    auto copy = std::make_shared<MissionSnapshot::Component>();
+    if (component.has_collection()) {
+        const auto &collection = component.collection();
+        copy->name = collection.name();
+        copy->elements = share(collection.elements(), previous ? previous->elements : no_elements,
+                               [](const MissionSnapshot::Element &element, const MissionSnapshot::Element *) {
+                                   return std::make_shared<const MissionSnapshot::Element>(element);
+                               });
+    } else {
+        copy->element = std::make_shared<const MissionSnapshot::Element>(component.element());
+    }
+    return copy;
+}
+
+// Returns true if the given protobuf component is a collection touched since
+// the last snapshot.
+bool MissionSnapshotBuilder::isTouched(const pb::mission::Mission::Component &component) const
+{
+    return component.has_collection() && _touched.contains(&component.collection());
+}
+
+// Returns the shared list of the given protobuf messages, given the previous
+// version of the list. The messages are split into chunks first, a chunk of
+// the previous version is shared when it starts with the same message and holds
+// the same messages, in the same order, none of them being touched. Then the
+// other chunks are made, sharing the items of the previous version whose
+// message is still there and copying the others with the given function. Such
+// items can only be found in the chunks of the previous version which aren't
+// shared, only those are looked up by their message.
+template <class Source, class T, class Copy>
+SharedList<T> MissionSnapshotBuilder::share(const google::protobuf::RepeatedPtrField<Source> &sources,
+                                            const SharedList<T> &previous, Copy copy)
+{
+    typedef typename SharedList<T>::Chunk Chunk;
+
+    QHash<const void *, int> previous_chunks;
+    previous_chunks.reserve(previous._chunks.count());
+    for (int i = 0; i < previous._chunks.count(); i++) {
+        previous_chunks.insert(previous._chunks.at(i)->sources.first(), i);
+    }
+
+    SharedList<T> list;
+    list._count = sources.size();
+    QVector<bool> is_shared(previous._chunks.count(), false);
+    for (int first = 0, last = 0; first < sources.size(); first = last) {
+        last = first + 1;
+        while (last < sources.size() && last - first < SharedChunkMaxSize && !isChunkEnd(&sources.Get(last - 1))) {
+            last++;
+        }
+
+        const auto &index = previous_chunks.value(&sources.Get(first), -1);
+        auto is_same = index >= 0 && previous._chunks.at(index)->sources.count() == last - first;
+        for (int i = first; i < last && is_same; i++) {
+            is_same = previous._chunks.at(index)->sources.at(i - first) == &sources.Get(i) &&
+                      !isTouched(sources.Get(i));
+        }
+        list._offsets.append(first);
+        list._chunks.append(is_same ? previous._chunks.at(index) : nullptr);
+        if (is_same) is_shared[index] = true;
+    }
+
+    QHash<const void *, std::shared_ptr<const T>> items;
+    auto is_indexed = false;
+    for (int i = 0; i < list._chunks.count(); i++) {
+        if (list._chunks.at(i)) continue;
+
+        if (!is_indexed) {
+            for (int j = 0; j < previous._chunks.count(); j++) {
+                if (is_shared.at(j)) continue;
+                const auto &chunk = previous._chunks.at(j);
+                for (int k = 0; k < chunk->sources.count(); k++) {
+                    items.insert(chunk->sources.at(k), chunk->items.at(k));
+                }
+            }
+            is_indexed = true;
+        }
+
+        const auto &first = list._offsets.at(i);
+        const auto &last = i + 1 < list._offsets.count() ? list._offsets.at(i + 1) : list._count;
+        auto chunk = std::make_shared<Chunk>();
+        chunk->sources.reserve(last - first);
+        chunk->items.reserve(last - first);
+        for (int j = first; j < last; j++) {
+            const auto &source = sources.Get(j);
+            auto item = items.value(&source);
+            if (!item || isTouched(source)) item = copy(source, item.get());
+            chunk->sources.append(&source);
+            chunk->items.append(item);
+        }
+        list._chunks[i] = chunk;
+    }
+    return list;
+}
@@ -0,0 +1,132 @@
+#ifndef RTSYS_MISSION_SNAPSHOT_H
+#define RTSYS_MISSION_SNAPSHOT_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include "protobuf/mission.pb.h"
+
+#include <QSet>
+#include <QVector>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The average and the maximum number of items of a chunk of a shared list,
+// see SharedList.
+const int SharedChunkSize = 256;
+const int SharedChunkMaxSize = 4 * SharedChunkSize;
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines an immutable list whose items are shared between versions. The
+// items are kept by chunks, and both the chunks and the items are shared: a
+// version of the list only allocates the chunks which differ from the previous
+// version. Each item also remembers the protobuf message it was copied from
+// (its source), so that the next version recognizes the unchanged messages.
+// The chunks end after the sources picked by their address and not at fixed
+// positions, so that an insertion or a removal only changes the chunk around
+// it and not all the following ones.
+template <class T>
+class SharedList
+{
+  public:
+    struct Chunk {
+        QVector<const void *> sources;
+        QVector<std::shared_ptr<const T>> items;
+    };
+
+  public:
+    int count() const { return _count; }
+    const T &at(int i) const;
+    int chunkCount() const { return _chunks.count(); }
+    const Chunk &chunk(int i) const { return *_chunks.at(i); }
+
+  private:
+    friend class MissionSnapshotBuilder;
+
+    QVector<std::shared_ptr<const Chunk>> _chunks;
+    QVector<int> _offsets;
+    int _count = 0;
+};
+
+// This defines a snapshot of a mission, an immutable version of it which can
+// be compared or rolled back to later on. The snapshots share every subtree
+// which didn't change between them, see MissionSnapshotBuilder. A component
+// of the snapshot is either an element, or a collection given by its name and
+// its elements.
+class MissionSnapshot
+{
+  public:
+    typedef pb::mission::Mission::Element Element;
+
+    struct Component {
+        std::shared_ptr<const Element> element;
+        std::string name;
+        SharedList<Element> elements;
+
+        bool isCollection() const { return !element; }
+    };
+
+  public:
+    bool isNull() const { return !_is_valid; }
+    const std::string &name() const { return _name; }
+    const SharedList<Component> &components() const { return _components; }
+    void copyTo(pb::mission::Mission *mission) const;
+
+  private:
+    friend class MissionSnapshotBuilder;
+
+    bool _is_valid = false;
+    std::string _name;
+    SharedList<Component> _components;
+};
+
+// This defines the builder of the snapshots of a mission. It keeps the last
+// snapshot taken, the next one shares all of its chunks and components which
+// are unchanged: the chunks whose protobuf messages are the same, in the same
+// order, and the components whose protobuf message survived an insertion or a
+// removal around them. The protobuf messages are never compared, the owner of
+// the mission tells which collections changed (see touch), so taking a
+// snapshot only copies the paths changed since the last one.
+// The messages are recognized by their address, the mission must be allocated
+// on an arena which isn't reset until the builder is cleared.
+class MissionSnapshotBuilder
+{
+  public:
+    MissionSnapshot take(const pb::mission::Mission &mission);
+    void touch(const google::protobuf::Message *collection);
+    void clear();
+
+  private:
+    std::shared_ptr<const MissionSnapshot::Component> copyComponent(const pb::mission::Mission::Component &component,
+                                                                     const MissionSnapshot::Component *previous);
+    bool isTouched(const pb::mission::Mission::Component &component) const;
+    bool isTouched(const pb::mission::Mission::Element &) const { return false; }
+
+    template <class Source, class T, class Copy>
+    SharedList<T> share(const google::protobuf::RepeatedPtrField<Source> &sources, const SharedList<T> &previous,
+                        Copy copy);
+
+    MissionSnapshot _last;
+    QSet<const google::protobuf::Message *> _touched;
+};
+
+// Returns the item at the given position. The chunk holding it is looked up by
+// its offset, prefer iterating over the chunks to go through the whole list.
+template <class T>
+const T &SharedList<T>::at(int i) const
+{
+    const auto &chunk = std::upper_bound(_offsets.cbegin(), _offsets.cend(), i) - _offsets.cbegin() - 1;
+    return *_chunks.at(chunk)->items.at(i - _offsets.at(chunk));
+}
+
+#endif // RTSYS_MISSION_SNAPSHOT_H
@@ -0,0 +1,147 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/stats.h"
+
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QtAlgorithms>
+
+// ===
+// === Define
+// ============================================================================ //
+
+namespace stats {
+
+const char *const ProbeNames[kProbeCount] = {
+    "model.data",   "model.index",  "model.parent", "model.rowCount", "backend.icon", "backend.maskEnableAction",
+    "manager.load", "manager.save", "manager.remove",
+};
+
+QAtomicInt Enabled(0);
+
+// The counters of a probe. They are updated with relaxed atomics: a snapshot
+// taken while probes are recorded may be off by the calls in progress.
+struct Counters {
+    QAtomicInteger<qint64> count;
+    QAtomicInteger<qint64> nsecs;
+    QAtomicInteger<qint64> max_nsecs;
+    QAtomicInteger<qint64> histogram[HistogramSize];
+};
+
+static Counters AllCounters[kProbeCount];
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns the index of the histogram bucket of the given latency.
+static int bucketOf(qint64 nsecs)
+{
+    if (nsecs <= 1) return 0;
+    return qMin(63 - static_cast<int>(qCountLeadingZeroBits(static_cast<quint64>(nsecs))), HistogramSize - 1);
+}
+
+// Returns the latency under which the given percentage of the calls fall. The
+// latency is the upper bound of its histogram bucket, capped to the maximum.
+qint64 Sample::percentile(double percent) const
+{
+    if (!count) return 0;
+
+    const auto &rank = static_cast<qint64>(count * percent / 100);
+    qint64 calls = 0;
+    for (int i = 0; i < HistogramSize; i++) {
+        calls += histogram[i];
+        if (calls > rank) return qMin((qint64(1) << (i + 1)) - 1, max_nsecs);
+    }
+    return max_nsecs;
+}
+
+// Returns the snapshot as a json object, one entry per probe called at least
+// once. The latencies are given in nanoseconds.
+QJsonObject Snapshot::toJson() const
+{
+    QJsonObject object;
+    for (int i = 0; i < kProbeCount; i++) {
+        const auto &sample = samples[i];
+        if (!sample.count) continue;
+
+        QJsonArray histogram;
+        for (const auto &calls : sample.histogram) {
+            histogram.append(static_cast<double>(calls));
+        }
+        QJsonObject probe_object;
+        probe_object["count"] = static_cast<double>(sample.count);
+        probe_object["total"] = static_cast<double>(sample.nsecs);
+        probe_object["mean"] = static_cast<double>(sample.nsecs) / sample.count;
+        probe_object["p50"] = static_cast<double>(sample.percentile(50));
+        probe_object["p99"] = static_cast<double>(sample.percentile(99));
+        probe_object["max"] = static_cast<double>(sample.max_nsecs);
+        probe_object["histogram"] = histogram;
+        object[ProbeNames[i]] = probe_object;
+    }
+    return object;
+}
+
+// Enables or disables the recording of the probes.
+void setEnabled(bool is_enabled)
+{
+    Enabled.store(is_enabled);
+}
+
+// Returns the current time of the monotonic clock in nanoseconds. It is never
+// zero, so that the probes can tell whether they were started.
+qint64 now()
+{
+    static const auto clock = []() {
+        QElapsedTimer clock;
+        clock.start();
+        return clock;
+    }();
+    return clock.nsecsElapsed() + 1;
+}
+
+// Records a call of the given probe which lasted the given time.
+void record(Probe probe, qint64 nsecs)
+{
+    auto &counters = AllCounters[probe];
+    counters.count.fetchAndAddRelaxed(1);
+    counters.nsecs.fetchAndAddRelaxed(nsecs);
+    counters.histogram[bucketOf(nsecs)].fetchAndAddRelaxed(1);
+    auto max_nsecs = counters.max_nsecs.load();
+    while (nsecs > max_nsecs && !counters.max_nsecs.testAndSetRelaxed(max_nsecs, nsecs, max_nsecs)) {
+    }
+}
+
+// Returns the stats of all the probes recorded so far.
+Snapshot snapshot()
+{
+    Snapshot snapshot;
+    for (int i = 0; i < kProbeCount; i++) {
+        const auto &counters = AllCounters[i];
+        auto &sample = snapshot.samples[i];
+        sample.count = counters.count.load();
+        sample.nsecs = counters.nsecs.load();
+        sample.max_nsecs = counters.max_nsecs.load();
+        for (int j = 0; j < HistogramSize; j++) {
+            sample.histogram[j] = counters.histogram[j].load();
+        }
+    }
+    return snapshot;
+}
+
+// Resets the stats of all the probes.
+void reset()
+{
+    for (auto &counters : AllCounters) {
+        counters.count.store(0);
+        counters.nsecs.store(0);
+        counters.max_nsecs.store(0);
+        for (auto &calls : counters.histogram) {
+            calls.store(0);
+        }
+    }
+}
+
+} // namespace stats
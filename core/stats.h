@@ -0,0 +1,110 @@
+#ifndef RTSYS_MISSION_STATS_H
+#define RTSYS_MISSION_STATS_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include <QAtomicInt>
+#include <QJsonObject>
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The probes are compiled in only when the RTSYS_MISSION_STATS macro is
+// defined (qmake CONFIG+=mission_stats, see core.pri), otherwise they expand
+// to nothing. Once compiled in, they record nothing until the stats are
+// enabled at runtime (see stats::setEnabled): a disabled probe costs a single
+// predictable branch on a relaxed load.
+#ifdef RTSYS_MISSION_STATS
+#define MISSION_STATS_PROBE(probe) const stats::Scope stats_scope(stats::probe)
+#define MISSION_STATS_RECORD(probe, nsecs)                                      \
+    do {                                                                        \
+        if (Q_UNLIKELY(stats::isEnabled())) stats::record(stats::probe, nsecs); \
+    } while (0)
+#else
+#define MISSION_STATS_PROBE(probe)
+#define MISSION_STATS_RECORD(probe, nsecs) \
+    do {                                   \
+    } while (0)
+#endif
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines the instrumentation of the mission hot paths: the number of
+// calls and the latency histogram of each probe. The stats are shared by the
+// whole process and may be recorded from any thread.
+namespace stats {
+
+enum Probe {
+    kModelData,
+    kModelIndex,
+    kModelParent,
+    kModelRowCount,
+    kBackendIcon,
+    kBackendMaskEnableAction,
+    kManagerLoad,
+    kManagerSave,
+    kManagerRemove,
+    kProbeCount
+};
+
+// The latencies are counted by power of two nanoseconds: the bucket i counts
+// the latencies in [2^i, 2^(i+1)) ns, the last one counts everything above.
+const int HistogramSize = 40;
+
+extern const char *const ProbeNames[kProbeCount];
+extern QAtomicInt Enabled;
+
+// The stats of a probe at a given time.
+struct Sample {
+    qint64 count = 0;
+    qint64 nsecs = 0;
+    qint64 max_nsecs = 0;
+    qint64 histogram[HistogramSize] = {};
+
+    qint64 percentile(double percent) const;
+};
+
+// The stats of all the probes at a given time.
+struct Snapshot {
+    Sample samples[kProbeCount];
+
+    QJsonObject toJson() const;
+};
+
+inline bool isEnabled() { return Enabled.load(); }
+void setEnabled(bool is_enabled);
+qint64 now();
+void record(Probe probe, qint64 nsecs);
+Snapshot snapshot();
+void reset();
+
+// This defines the probe of a scope: the latency of the scope is recorded
+// when it is left, if the stats were enabled when it was entered.
+class Scope
+{
+  public:
+    explicit Scope(Probe probe)
+        : _probe(probe)
+        , _start(Q_UNLIKELY(isEnabled()) ? now() : 0)
+    {
+    }
+    ~Scope()
+    {
+        if (Q_UNLIKELY(_start)) record(_probe, now() - _start);
+    }
+
+  private:
+    Q_DISABLE_COPY(Scope)
+
+    const Probe _probe;
+    const qint64 _start;
+};
+
+} // namespace stats
+
+#endif // RTSYS_MISSION_STATS_H
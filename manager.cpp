@@ -3,8 +3,22 @@
 // ============================================================================ //
 
 #include "manager.h"
-#include "private/model_misc.h"
+#include "core/file.h"
+#include "core/loader.h"
+#include "core/mission.h"
+#include "core/stats.h"
+
+#include <QCoreApplication>
 #include <QDebug>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QHash>
+#include <QJsonDocument>
+#include <QSaveFile>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
 
 // ===
 // === Class
@@ -12,8 +26,15 @@
 
 MissionManager::MissionManager(QObject *parent)
     : QObject(parent)
+    , _arena(std::make_unique<google::protobuf::Arena>(mission::arenaOptions()))
+    , _mission(nullptr)
+    , _read_components(0)
+    , _is_replaying(false)
+    , _is_undoing(false)
 {
     setObjectName("MissionManager");
+    _model.setSource(this);
+    connect(&_stats_timer, &QTimer::timeout, this, [this]() { writeStats(); });
 
     // Initialization of the mission data structure.
     newMission();
@@ -21,54 +42,207 @@ MissionManager::MissionManager(QObject *parent)
     addPoint(_model.index(0, 0, QModelIndex()));
     addPoint(_model.index(0, 0, QModelIndex()));
     addRail(_model.index(0, 0, QModelIndex()));
+    _history.clear();
 }
 
-MissionManager::~MissionManager() {}
+MissionManager::~MissionManager()
+{
+    if (_stats_timer.isActive()) writeStats();
+}
 
-// This creates a new mission.
+// This creates a new mission. The mission and all the messages added under it
+// are allocated on the manager arena.
 void MissionManager::newMission()
 {
-    _mission.Clear();
+    clearMission();
 
-    _mission.set_name("My New Mission");
-    _model.insertRow<decltype(_mission)>(0, QModelIndex(), &_mission);
+    _mission = google::protobuf::Arena::CreateMessage<pb::mission::Mission>(_arena.get());
+    _mission->set_name("My New Mission");
+    _model.insertRow(0, QModelIndex(), _mission);
 }
 
-// This clears the existing mission
+// This clears the existing mission. A loading in progress is stopped first,
+// since its worker allocates on the arena, and the mission it was loading is
+// dropped. The items are released, then the whole protobuf mission is
+// released at once by resetting the arena, instead of clearing and destroying
+// its messages one by one. The edits journaled for the mission, its history
+// and its last snapshot are dropped along.
 void MissionManager::clearMission()
 {
-    _model.removeRow(0, QModelIndex());
+    _loader.reset();
+    _load_arena.reset();
+    _journal.discard();
+    _history.clear();
+    _snapshots.clear();
+    _reader.reset();
+    _pending.clear();
+    _read_components = 0;
+    _entries.clear();
+    _model.clear();
+    _mission = nullptr;
+    _arena->Reset();
 }
 
 // Remove the index of the model specified by the given index. First we check if
-// the index is valid and then use its parent index and its row for removing it
+// the index is valid and then use its parent index and its row for removing it.
+// Nothing is removed while a mission is loading (see removeRows).
 void MissionManager::remove(const QModelIndex &index)
 {
-    if (!index.isValid()) return;
-
-    qDebug() << index << index.isValid() << index.parent() << index.parent().isValid();
+    if (_loader || !index.isValid()) return;
 
     if (index.parent().isValid())
-        _model.removeRow(index.row(), index.parent());
+        removeRows(index.row(), 1, index.parent());
     else
         clearMission();
 }
 
+// Removes the items specified by the given indexes, typically the selection of
+// the view. The indexes of a same item (one per column) count once, and the
+// items which can't be deleted (the mission itself) are dropped first, so that
+// an index is only skipped when one of its ancestors is removed. The indexes
+// are grouped by parent, the rows of each parent are sorted then split into
+// contiguous ranges, and each range is removed by the model at once (one
+// notification and one protobuf range deletion). The deepest parents are
+// handled first and the ranges from the last row, so that the indexes still
+// to be handled are never shifted by a removal. All the ranges are undone at
+// once. Nothing is removed while a mission is loading (see removeRows).
+void MissionManager::remove(const QModelIndexList &indexes)
+{
+    struct Group {
+        QModelIndex parent;
+        int depth;
+        QVector<int> rows;
+    };
+
+    if (_loader) return;
+
+    QHash<MissionItem *, QModelIndex> items;
+    for (const auto &index : indexes) {
+        if (!index.isValid()) continue;
+        auto *item = _model.item(index);
+        if (item->backend().hasEnableAction(MissionBackend::Action::kDelete)) items.insert(item, index);
+    }
+
+    QHash<MissionItem *, int> groups_index;
+    QVector<Group> groups;
+    for (auto it = items.cbegin(); it != items.cend(); ++it) {
+        auto *item = it.key();
+        auto depth = 0;
+        auto is_ancestor_removed = false;
+        for (auto *ancestor = item->parent(); ancestor && ancestor != _model.root(); ancestor = ancestor->parent()) {
+            is_ancestor_removed |= items.contains(ancestor);
+            depth++;
+        }
+        if (is_ancestor_removed || !depth) continue;
+
+        auto *parent = item->parent();
+        if (!groups_index.contains(parent)) {
+            groups_index.insert(parent, groups.count());
+            groups.append({it.value().parent(), depth, {}});
+        }
+        groups[groups_index.value(parent)].rows.append(item->row());
+    }
+
+    std::sort(groups.begin(), groups.end(), [](const Group &a, const Group &b) { return a.depth > b.depth; });
+    _history.beginStep();
+    for (auto &group : groups) {
+        std::sort(group.rows.begin(), group.rows.end(), std::greater<int>());
+        for (int i = 0; i < group.rows.count();) {
+            auto last = group.rows.at(i);
+            auto first = last;
+            while (++i < group.rows.count() && group.rows.at(i) == first - 1) first--;
+            removeRows(first, last - first + 1, group.parent);
+        }
+    }
+    _history.endStep();
+}
+
+// Removes the 'count' rows starting at the given row under the parent index.
+// The file entries of the removed components are dropped along, the removal
+// of anything else marks its component as dirty (see MissionBackend::remove).
+// The removed rows are serialized first when they are recorded into the
+// history or asked for by the given messages: the elements of the collections
+// not loaded yet are loaded then. Nothing is removed while a mission is
+// loading, like for every edit: the journal is only opened once the loading
+// ends, and its edits are replayed by row path on top of the loaded mission.
+bool MissionManager::removeRows(int row, int count, const QModelIndex &parent, QVector<QByteArray> *messages)
+{
+    MISSION_STATS_PROBE(kManagerRemove);
+    auto *parent_item = _model.item(parent);
+    if (_loader || !parent_item || row < 0 || count <= 0 || row + count > parent_item->childCount()) return false;
+
+    QVector<QByteArray> removed;
+    if (messages || isRecorded()) {
+        if (!parent.parent().isValid() && !_pending.isEmpty()) {
+            for (int i = row; i < row + count; i++) {
+                _model.fetchPending(_model.index(i, 0, parent), std::numeric_limits<int>::max());
+            }
+        }
+        auto &backend = parent_item->backend();
+        removed = mission::serialize(backend.protobuf(), backend.componentType(), row, count);
+    }
+    if (!_model.removeRows(row, count, parent)) return false;
+
+    if (!parent.parent().isValid()) _entries.remove(row, count);
+    if (parent.parent().isValid()) _snapshots.touch(parent_item->backend().protobuf());
+    journal(pb::mission::MissionEdit::kRemove, parent, row, count);
+    record(MissionHistory::Change::kRemove, parent, row, count, removed);
+    if (messages) messages->swap(removed);
+    return true;
+}
+
+// Inserts the given serialized messages (see mission::serialize) at the given
+// row under the parent index, in one range insertion. The inserted components
+// have no file entry, they are saved again. The children of a collection not
+// loaded yet are loaded first when the messages are inserted after the loaded
+// ones, so that they keep their order. Nothing is inserted while a mission is
+// loading (see removeRows).
+bool MissionManager::insertRows(int row, const QVector<QByteArray> &messages, const QModelIndex &parent)
+{
+    auto *parent_item = _model.item(parent);
+    if (_loader || !parent_item || messages.isEmpty()) return false;
+
+    auto &backend = parent_item->backend();
+    if (row >= backend.childCount()) _model.fetchPending(parent, std::numeric_limits<int>::max());
+    if (row < 0 || row > backend.childCount() || !backend.insert(row, messages)) {
+        qWarning() << "MissionManager" << __func__ << "inserting" << messages.count() << "rows fail";
+        return false;
+    }
+
+    if (!parent.parent().isValid()) _entries.insert(row, messages.count(), -1);
+    if (parent.parent().isValid()) _snapshots.touch(backend.protobuf());
+    _model.insertRange(parent, row, messages.count());
+    journal(pb::mission::MissionEdit::kInsert, parent, row, messages.count(), QString(), messages);
+    record(MissionHistory::Change::kInsert, parent, row, messages.count());
+    return true;
+}
+
 // Adds a point under the specified parent index. This check if the parent is
 // valid and if the "addPoint" action is enabled for the specified parent index.
 void MissionManager::addPoint(const QModelIndex &parent)
 {
-    if (!parent.isValid()) return;
-
-    const auto &parent_backend = _model.item(parent)->backend();
-    if (parent_backend.hasEnableAction(MissionBackend::Action::kAddPoint)) {      
-        const auto &row = _model.rowCount(parent);
-        auto *protobuf = static_cast<pb::mission::Mission::Element::Point *>(_model.item(parent)->backend().addPoint());
-        // protobuf->set_name(QString("My Point %1").arg(row).toStdString());
-        //_model.insertRow<pb::mission::Mission::Element::Point>(row, parent, protobuf);
-        qWarning() << "MissionManager" << __func__ << "adding point succeed";
+    addPoint(parent, QString());
+}
 
+// Adds a point of the given name under the specified parent index, the point
+// is named after its row when the name is empty. Nothing is added while a
+// mission is loading (see removeRows).
+void MissionManager::addPoint(const QModelIndex &parent, const QString &name)
+{
+    if (_loader || !parent.isValid()) return;
 
+    auto &parent_backend = _model.item(parent)->backend();
+    if (parent_backend.hasEnableAction(MissionBackend::Action::kAddPoint)) {
+        _model.fetchPending(parent, std::numeric_limits<int>::max());
+        const auto &row = parent_backend.childCount();
+        auto *protobuf = static_cast<pb::mission::Mission::Element::Point *>(parent_backend.addPoint());
+        const auto &point_name = name.isEmpty() ? QString("My Point %1").arg(row) : name;
+        protobuf->set_name(point_name.toStdString());
+        if (parent_backend.componentType() == mission::kMission) _entries.append(-1);
+        if (parent_backend.componentType() == mission::kCollection) _snapshots.touch(parent_backend.protobuf());
+        _model.appendRows(parent);
+        journal(pb::mission::MissionEdit::kAddPoint, parent, row, 1, point_name);
+        record(MissionHistory::Change::kInsert, parent, row, 1);
     } else {
         qWarning() << "MissionManager" << __func__ << "adding point fail because action is not enabled";
     }
@@ -78,70 +252,606 @@ void MissionManager::addPoint(const QModelIndex &parent)
 // valid and if the "addRail" action is enabled for the specified parent index.
 void MissionManager::addRail(const QModelIndex &parent)
 {
-    if (!parent.isValid()) return;
+    addRail(parent, QString());
+}
+
+// Adds a rail of the given name under the specified parent index, the rail is
+// named after its row when the name is empty. Nothing is added while a
+// mission is loading (see removeRows).
+void MissionManager::addRail(const QModelIndex &parent, const QString &name)
+{
+    if (_loader || !parent.isValid()) return;
 
-    const auto &parent_backend = _model.item(parent)->backend();
+    auto &parent_backend = _model.item(parent)->backend();
     if (parent_backend.hasEnableAction(MissionBackend::Action::kAddRail)) {
-        const auto &row = _model.rowCount(parent);
-        auto *protobuf = static_cast<pb::mission::Mission::Element::Rail *>(_model.item(parent)->backend().addRail());
-        protobuf->set_name(QString("My Rail %1").arg(row).toStdString());
+        _model.fetchPending(parent, std::numeric_limits<int>::max());
+        const auto &row = parent_backend.childCount();
+        auto *protobuf = static_cast<pb::mission::Mission::Element::Rail *>(parent_backend.addRail());
+        const auto &rail_name = name.isEmpty() ? QString("My Rail %1").arg(row) : name;
+        protobuf->set_name(rail_name.toStdString());
         protobuf->mutable_p0()->set_name("P1");
         protobuf->mutable_p1()->set_name("P2");
-        misc::appendRail(protobuf, _model.item(parent));
+        if (parent_backend.componentType() == mission::kMission) _entries.append(-1);
+        if (parent_backend.componentType() == mission::kCollection) _snapshots.touch(parent_backend.protobuf());
+        _model.appendRows(parent);
+        journal(pb::mission::MissionEdit::kAddRail, parent, row, 1, rail_name);
+        record(MissionHistory::Change::kInsert, parent, row, 1);
     } else {
         qWarning() << "MissionManager" << __func__ << "adding rail fail because action is not enabled";
     }
 }
 
-void MissionManager::loadMission(pb::mission::Mission *mission)
+// Loads the given mission, it replaces the existing one. The manager takes
+// the given mission over, it is copied onto an arena of its own by a worker
+// thread (see startLoader) then deleted along with the loader.
+void MissionManager::loadMission(std::unique_ptr<pb::mission::Mission> mission)
 {
-    auto appendItem = [&](auto *msg, MissionItem *parent) {
-        auto *item = new MissionItem(
-            {QString::fromStdString(msg->GetDescriptor()->name()), QString::fromStdString(msg->name())}, msg, parent);
-        parent->appendChild(item);
-        return item;
-    };
+    startLoader(new MissionLoader(std::move(mission), createLoadArena(), this));
+}
+
+// Opens the mission serialized into the file specified by the given path, it
+// replaces the existing mission. The file is checked first: it must be
+// readable, and a streaming mission file must have a valid header and index
+// (see file::StreamReader::open). Then it is parsed straight onto an arena of
+// its own by a worker thread (see startLoader), through the reader which
+// checked it. This returns false, the existing mission being left untouched,
+// when the file can't be read, the outcome of the parsing is given by
+// loadFinished.
+bool MissionManager::openFile(const QString &path)
+{
+    if (!QFileInfo(path).isReadable()) {
+        qWarning() << "MissionManager" << __func__ << "opening" << path << "fail";
+        return false;
+    }
+
+    auto stream = std::make_shared<file::StreamReader>(path);
+    const auto &is_stream = stream->open();
+    if (stream->hasError()) {
+        qWarning() << "MissionManager" << __func__ << "opening" << path << "fail: the file is corrupted";
+        return false;
+    }
 
-    auto appendElement = [&](pb::mission::Mission::Element *element, MissionItem *parent) {
-        MissionItem *elder;
-        switch (element->element_case()) {
-            case pb::mission::Mission::Element::kPoint:
-                appendItem(element->mutable_point(), parent);
-                break;
-            case pb::mission::Mission::Element::kRail:
-                elder = appendItem(element->mutable_rail(), parent);
-                appendItem(element->mutable_rail()->mutable_p0(), elder);
-                appendItem(element->mutable_rail()->mutable_p1(), elder);
-                break;
-            case pb::mission::Mission::Element::kSegment:
-                elder = appendItem(element->mutable_segment(), parent);
-                appendItem(element->mutable_segment()->mutable_p0(), elder);
-                appendItem(element->mutable_segment()->mutable_p1(), elder);
-                break;
-            default:
-                break;
+    auto *arena = createLoadArena();
+    startLoader(is_stream ? new MissionLoader(stream, arena, this) : new MissionLoader(path, arena, this));
+    return true;
+}
+
+// Returns a new arena for the mission to load. The mission is loaded on an
+// arena of its own, so that the existing mission is kept until the loaded one
+// replaces it (see showMission), or kept for good when the loading fails. A
+// loading in progress is canceled first.
+google::protobuf::Arena *MissionManager::createLoadArena()
+{
+    cancelLoad();
+    _load_arena = std::make_unique<google::protobuf::Arena>(mission::arenaOptions());
+    return _load_arena.get();
+}
+
+// Stops the loading in progress. The components already loaded are kept.
+void MissionManager::cancelLoad()
+{
+    if (!_loader) return;
+
+    _loader->requestInterruption();
+    _loader->wait();
+    finishLoad();
+    emit loadCanceled();
+}
+
+// Starts the given loader. The loader parses the mission on a worker thread
+// while the event loop keeps running: the mission item is inserted as soon as
+// the mission header is loaded, then each batch of components is appended at
+// once. The slots use the loader as context, so that they run on this thread
+// and that the signals not yet delivered are dropped with the loader. The
+// edits are refused until the loading finishes (see loadStarted and
+// loadFinished).
+void MissionManager::startLoader(MissionLoader *loader)
+{
+    _loader.reset(loader);
+    connect(loader, &MissionLoader::missionReady, loader, [this]() { showMission(); });
+    connect(loader, &MissionLoader::componentsReady, loader, [this]() { appendComponents(); });
+    connect(loader, &MissionLoader::progress, loader, [this](qint64 done, qint64 total) {
+        emit loadProgress(done, total);
+    });
+    connect(loader, &QThread::finished, loader, [this]() { finishLoad(); });
+
+    _load_elapsed.start();
+    loader->start();
+    emit loadStarted();
+}
+
+// Inserts the item of the loaded mission, once its header is loaded. The
+// loaded mission replaces the existing one from then on: the existing mission
+// is cleared, and the arena of the loaded one becomes the mission arena.
+void MissionManager::showMission()
+{
+    if (!_loader || !_loader->mission() || _mission == _loader->mission()) return;
+
+    auto loader = std::move(_loader);
+    auto arena = std::move(_load_arena);
+    clearMission();
+    _loader = std::move(loader);
+    _arena = std::move(arena);
+    _mission = _loader->mission();
+    _reader = _loader->reader();
+    _entries.fill(-1, _mission->components_size());
+    _model.insertRow(0, QModelIndex(), _mission);
+    qInfo() << "MissionManager" << __func__ << "mission shown after" << _load_elapsed.nsecsElapsed() / 1e6 << "ms";
+}
+
+// Appends the components loaded so far to the loaded mission, once shown.
+// The components are allocated on the mission arena, so they are added
+// without being copied. Their rows are inserted at once, whatever the number
+// of components.
+void MissionManager::appendComponents()
+{
+    if (!_loader || !_mission || _mission != _loader->mission()) return;
+
+    const auto &components = _loader->takeComponents();
+    if (components.isEmpty()) return;
+
+    const auto &first = _mission->components_size();
+    auto *repeated = _mission->mutable_components();
+    repeated->Reserve(first + components.count());
+    for (auto *component : components) {
+        repeated->AddAllocated(component);
+    }
+
+    // The components read from an indexed file are recorded with their
+    // position in the file, so that they are saved again only when changed.
+    // The collections whose elements were left in the file are recorded as
+    // well, to be loaded on demand.
+    if (_reader && _reader->hasIndex()) {
+        const auto &index = _reader->index();
+        for (auto *component : components) {
+            const auto &position = _read_components++;
+            _entries.append(position);
+            if (component->has_collection() && MissionLoader::isPending(index.components(position))) {
+                _pending.insert(component->mutable_collection(), {position, 0});
+            }
         }
-    };
+    } else {
+        _entries.insert(_entries.count(), components.count(), -1);
+    }
+
+    const auto &index = _model.index(0, 0, QModelIndex());
+    _model.item(index)->backend().countAppended(first);
+    _model.appendRows(index, components.count());
+}
+
+// Finishes the loading once the worker is done. The mission and its last
+// components are added, whether their signals were delivered or not, and the
+// loading throughput is reported. When not even the mission header could be
+// loaded, the existing mission is kept along with its journal, a new mission
+// is created only when there is none.
+void MissionManager::finishLoad()
+{
+    if (!_loader) return;
+
+    showMission();
+    appendComponents();
+    const auto &is_shown = _mission && _mission == _loader->mission();
+
+    // The signals left are dropped, the loader is deleted later since this may
+    // run from one of its signals.
+    auto *loader = _loader.release();
+    QCoreApplication::removePostedEvents(loader);
+    loader->deleteLater();
+
+    const auto &success = !loader->hasError() && !loader->isInterruptionRequested();
+    _load_arena.reset();
+    if (!is_shown) {
+        if (!_mission) newMission();
+    } else {
+        const auto &bytes = loader->bytes();
+        const auto nsecs = qMax<qint64>(_load_elapsed.nsecsElapsed(), 1);
+        MISSION_STATS_RECORD(kManagerLoad, nsecs);
+        qInfo() << "MissionManager" << __func__ << bytes << "bytes loaded in" << nsecs / 1e6 << "ms,"
+                << bytes / (nsecs / 1e9) / (1024 * 1024) << "MB/s" << (success ? "" : "(incomplete)");
+        if (success) openJournal(true);
+    }
+    emit loadFinished(success && is_shown);
+}
+
+// Returns the row path of the given index from the mission item, the path of
+// the mission item is empty.
+QVector<int> MissionManager::pathOf(const QModelIndex &index) const
+{
+    QVector<int> path;
+    for (auto parent = index; parent.parent().isValid(); parent = parent.parent()) {
+        path.prepend(parent.row());
+    }
+    return path;
+}
+
+// Returns the index specified by the given row path from the mission item (see
+// pathOf). The rows along the path are fetched when they aren't yet. The index
+// isn't valid when the path leads nowhere.
+QModelIndex MissionManager::indexOf(const QVector<int> &path)
+{
+    auto index = _model.index(0, 0, QModelIndex());
+    for (const auto &row : path) {
+        fetchRows(index, row + 1);
+        index = _model.index(row, 0, index);
+    }
+    return index;
+}
+
+// Fetches the rows under the parent index until 'count' of them are fetched,
+// or all of them.
+void MissionManager::fetchRows(const QModelIndex &parent, int count)
+{
+    while (_model.rowCount(parent) < count && _model.canFetchMore(parent)) {
+        _model.fetchMore(parent);
+    }
+}
+
+// Journals the given edit made under the specified parent index, see
+// MissionEdit. The parent is recorded as its row path from the mission item.
+// The edits replayed from the journal are already journaled.
+void MissionManager::journal(pb::mission::MissionEdit::Type type, const QModelIndex &parent, int row, int count,
+                             const QString &name, const QVector<QByteArray> &messages)
+{
+    if (!_journal.isOpen() || _is_replaying) return;
+
+    pb::mission::MissionEdit edit;
+    edit.set_type(type);
+    for (const auto &parent_row : pathOf(parent)) {
+        edit.add_parent(parent_row);
+    }
+    edit.set_row(row);
+    edit.set_count(count);
+    if (!name.isEmpty()) edit.set_name(name.toStdString());
+    for (const auto &message : messages) {
+        edit.add_messages(message.constData(), message.size());
+    }
+    _journal.append(edit);
+}
+
+// Opens the journal of the indexed file the mission was read from or saved to.
+// The journal applies to the file up to the trailer of its index, so that the
+// tail left by a save interrupted along with the session doesn't hide it.
+// When replayed, the edits left by a previous session which didn't save them,
+// typically because of a crash, are applied again on top of the file and the
+// journal keeps them. Otherwise the journal starts over.
+void MissionManager::openJournal(bool is_replayed)
+{
+    if (!_reader || !_reader->hasIndex()) return;
 
-    auto appendCollection = [&](pb::mission::Mission::Collection *collection, MissionItem *parent) {
-        auto *elder = appendItem(collection, parent);
-        for (auto &element : *collection->mutable_elements()) {
-            appendElement(&element, elder);
+    QVector<pb::mission::MissionEdit> edits;
+    const auto &path = _reader->path() + ".journal";
+    if (!_journal.open(path, _reader->validSize(), _reader->checksum(), is_replayed ? &edits : nullptr)) return;
+    if (edits.isEmpty()) return;
+
+    _is_replaying = true;
+    for (const auto &edit : edits) {
+        applyEdit(edit);
+    }
+    _is_replaying = false;
+    qInfo() << "MissionManager" << __func__ << edits.count() << "edits replayed from" << path;
+}
+
+// Applies the given journaled edit. The rows of its parent path, and the rows
+// it removes, are fetched first since the journaled rows were all fetched.
+void MissionManager::applyEdit(const pb::mission::MissionEdit &edit)
+{
+    QVector<int> path;
+    for (const auto &row : edit.parent()) {
+        path.append(static_cast<int>(row));
+    }
+    const auto &parent = indexOf(path);
+    if (!parent.isValid()) {
+        qWarning() << "MissionManager" << __func__ << "edit parent not found, skipped";
+        return;
+    }
+
+    const auto &name = QString::fromStdString(edit.name());
+    switch (edit.type()) {
+        case pb::mission::MissionEdit::kAddPoint:
+            addPoint(parent, name);
+            break;
+        case pb::mission::MissionEdit::kAddRail:
+            addRail(parent, name);
+            break;
+        case pb::mission::MissionEdit::kRemove:
+            fetchRows(parent, static_cast<int>(edit.row() + edit.count()));
+            removeRows(static_cast<int>(edit.row()), static_cast<int>(edit.count()), parent);
+            break;
+        case pb::mission::MissionEdit::kInsert: {
+            QVector<QByteArray> messages;
+            messages.reserve(edit.messages_size());
+            for (const auto &message : edit.messages()) {
+                messages.append(QByteArray(message.data(), static_cast<int>(message.size())));
+            }
+            fetchRows(parent, static_cast<int>(edit.row()));
+            insertRows(static_cast<int>(edit.row()), messages, parent);
+            break;
         }
-    };
+        default:
+            break;
+    }
+}
+
+// Records the given change made under the specified parent index into the
+// history, see MissionHistory. The edits replayed from the journal and the
+// changes undone or redone aren't recorded.
+void MissionManager::record(MissionHistory::Change::Type type, const QModelIndex &parent, int row, int count,
+                            const QVector<QByteArray> &messages)
+{
+    if (!isRecorded()) return;
+
+    _history.record({type, pathOf(parent), row, count, messages});
+}
 
-    auto *elder = appendItem(mission, _model.root());
-
-    for (auto &component : *mission->mutable_components()) {
-        switch (component.component_case()) {
-            case pb::mission::Mission::Component::kElement:
-                appendElement(component.mutable_element(), elder);
-                break;
-            case pb::mission::Mission::Component::kCollection:
-                appendCollection(component.mutable_collection(), elder);
-                break;
-            default:
-                break;
+// Undoes the last step of the history, its changes are reverted from the last
+// one. Nothing is undone while a mission is loading.
+void MissionManager::undo()
+{
+    if (_loader || !_history.canUndo()) return;
+
+    auto step = _history.takeUndo();
+    auto success = true;
+    _is_undoing = true;
+    for (int i = step.count() - 1; i >= 0 && success; i--) {
+        success = applyChange(&step[i], true);
+    }
+    _is_undoing = false;
+
+    if (success) {
+        _history.pushRedo(step);
+    } else {
+        qWarning() << "MissionManager" << __func__ << "undoing fail, the history is dropped";
+        _history.clear();
+    }
+}
+
+// Redoes the last step undone, its changes are made again in order. Nothing is
+// redone while a mission is loading.
+void MissionManager::redo()
+{
+    if (_loader || !_history.canRedo()) return;
+
+    auto step = _history.takeRedo();
+    auto success = true;
+    _is_undoing = true;
+    for (int i = 0; i < step.count() && success; i++) {
+        success = applyChange(&step[i], false);
+    }
+    _is_undoing = false;
+
+    if (success) {
+        _history.pushUndo(step);
+    } else {
+        qWarning() << "MissionManager" << __func__ << "redoing fail, the history is dropped";
+        _history.clear();
+    }
+}
+
+// Makes the given change again, or reverts it when undone. Removing rows keeps
+// them serialized into the change and inserting them back releases them, so
+// that the history only holds the rows out of the mission.
+bool MissionManager::applyChange(MissionHistory::Change *change, bool is_undone)
+{
+    const auto &parent = indexOf(change->parent);
+    if (!parent.isValid()) return false;
+
+    const auto &is_inserted = (change->type == MissionHistory::Change::kInsert) != is_undone;
+    if (is_inserted) {
+        fetchRows(parent, change->row);
+        if (!insertRows(change->row, change->messages, parent)) return false;
+        change->messages.clear();
+        return true;
+    }
+    fetchRows(parent, change->row + change->count);
+    return removeRows(change->row, change->count, parent, &change->messages);
+}
+
+// Returns the number of elements of the given collection not loaded yet from
+// the indexed mission file.
+int MissionManager::pendingCount(const google::protobuf::Message *protobuf) const
+{
+    if (_pending.isEmpty()) return 0;
+
+    const auto &it = _pending.constFind(protobuf);
+    if (it == _pending.cend()) return 0;
+    return _reader->index().components(it->component).element_offsets_size() - it->loaded;
+}
+
+// Loads the next 'count' elements of the given collection not loaded yet, at
+// most. Each element is parsed straight from its byte range in the indexed
+// mission file, the other elements of the file aren't read.
+void MissionManager::loadPending(google::protobuf::Message *protobuf, int count)
+{
+    auto it = _pending.find(protobuf);
+    if (it == _pending.end()) return;
+
+    auto *elements = static_cast<pb::mission::Mission::Collection *>(protobuf)->mutable_elements();
+    const auto &entry = _reader->index().components(it->component);
+    const auto &last = static_cast<int>(qMin<qint64>(entry.element_offsets_size(), qint64(it->loaded) + count));
+    elements->Reserve(elements->size() + last - it->loaded);
+    for (; it->loaded < last; it->loaded++) {
+        if (!_reader->readElement(it->component, it->loaded, elements->Add())) {
+            elements->RemoveLast();
+            qWarning() << "MissionManager" << __func__ << "loading the elements of" << entry.name().c_str() << "fail";
+            break;
         }
     }
+    if (it->loaded == entry.element_offsets_size() || it->loaded < last) _pending.erase(it);
+    _snapshots.touch(protobuf);
+}
+
+// Loads all the elements of the collections not loaded yet. The elements of
+// a fetched collection are loaded through the model, so that its item
+// counts them, the elements of the others are loaded straight away.
+void MissionManager::loadAllPending()
+{
+    if (_pending.isEmpty()) return;
+
+    const auto &mission_index = _model.index(0, 0, QModelIndex());
+    const auto &fetched = _model.rowCount(mission_index);
+    for (int row = 0; row < _mission->components_size() && !_pending.isEmpty(); row++) {
+        auto *component = _mission->mutable_components(row);
+        if (!component->has_collection() || !_pending.contains(component->mutable_collection())) continue;
+
+        if (row < fetched) {
+            _model.fetchPending(_model.index(row, 0, mission_index), std::numeric_limits<int>::max());
+        } else {
+            loadPending(component->mutable_collection(), std::numeric_limits<int>::max());
+        }
+    }
+}
+
+// Returns a snapshot of the mission, see MissionSnapshot. Only the paths
+// changed since the last snapshot are copied, everything else is shared with
+// it: taking a snapshot of an unchanged mission only compares its components.
+// A loading in progress is finished first and the elements not loaded yet are
+// loaded, so that the snapshot holds the whole mission.
+MissionSnapshot MissionManager::snapshot()
+{
+    if (_loader) {
+        _loader->wait();
+        finishLoad();
+    }
+    if (!_mission) return MissionSnapshot();
+
+    loadAllPending();
+    return _snapshots.take(*_mission);
+}
+
+// Rolls the mission back to the given snapshot. The snapshot replaces the
+// existing mission like a loaded one, the edits journaled and the history are
+// dropped, and the mission is marked as modified since it isn't the one of
+// its file anymore. The snapshot itself is left untouched.
+bool MissionManager::restoreSnapshot(const MissionSnapshot &snapshot)
+{
+    if (snapshot.isNull()) return false;
+
+    clearMission();
+    _mission = google::protobuf::Arena::CreateMessage<pb::mission::Mission>(_arena.get());
+    snapshot.copyTo(_mission);
+    _entries.fill(-1, _mission->components_size());
+    _model.insertRow(0, QModelIndex(), _mission);
+    _model.item(_model.index(0, 0, QModelIndex()))->backend().setDirty();
+    return true;
+}
+
+// Returns the stats of the mission hot paths recorded so far (see
+// core/stats.h). The stats are shared by the whole process, and they stay
+// empty unless the probes are compiled in and enabled.
+stats::Snapshot MissionManager::stats() const
+{
+    return stats::snapshot();
+}
+
+// Enables the stats then dumps them as json into the file specified by the
+// given path, every 'interval' milliseconds and once more when the manager is
+// destroyed. Each dump replaces the previous one. A null interval stops the
+// dumps, the stats stay enabled. The dumps stay empty when the probes aren't
+// compiled in (see core/stats.h), which is warned about.
+void MissionManager::dumpStats(const QString &path, int interval)
+{
+    _stats_timer.stop();
+    _stats_path = path;
+    if (path.isEmpty() || interval <= 0) return;
+
+#ifndef RTSYS_MISSION_STATS
+    qWarning() << "MissionManager" << __func__ << "the probes aren't compiled in (qmake CONFIG+=mission_stats),"
+               << path << "stays empty";
+#endif
+
+    stats::setEnabled(true);
+    _stats_timer.start(interval);
+}
+
+// Writes the stats into the dump file. The file is replaced at once, a reader
+// never sees a partial dump.
+void MissionManager::writeStats()
+{
+    const auto &json = QJsonDocument(stats().toJson()).toJson();
+    QSaveFile file(_stats_path);
+    if (!file.open(QIODevice::WriteOnly) || file.write(json) != json.size() || !file.commit()) {
+        qWarning() << "MissionManager" << __func__ << "writing" << _stats_path << "fail";
+    }
+}
+
+// Returns true if the mission changed since it was loaded or last saved.
+bool MissionManager::isModified() const
+{
+    auto *mission_item = _model.item(_model.index(0, 0, QModelIndex()));
+    return mission_item && mission_item->backend().isDirty();
+}
+
+// Saves the mission into the file specified by the given path, using the
+// streaming mission format. Only the dirty components are serialized, the
+// others are kept from the file the mission was read from or last saved to
+// (see file::saveStream), so that the save time follows the size of the edit.
+// A loading in progress is finished first. The saved file becomes the file of
+// the mission.
+bool MissionManager::saveFile(const QString &path)
+{
+    MISSION_STATS_PROBE(kManagerSave);
+    if (_loader) {
+        _loader->wait();
+        finishLoad();
+    }
+    if (!_mission) return false;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const auto &mission_index = _model.index(0, 0, QModelIndex());
+    auto *mission_item = _model.item(mission_index);
+    const auto &canonical_path = QFileInfo(path).canonicalFilePath();
+    if (_reader && !canonical_path.isEmpty() && canonical_path == QFileInfo(_reader->path()).canonicalFilePath() &&
+        !mission_item->backend().isDirty()) {
+        return true;
+    }
+
+    // The components which were never fetched were never changed. A dirty
+    // collection whose elements aren't all loaded yet is loaded first.
+    auto entries = _entries;
+    for (int row = 0; row < mission_item->childCount(); row++) {
+        if (!mission_item->child(row)->backend().isDirty()) continue;
+
+        entries[row] = -1;
+        _model.fetchPending(_model.index(row, 0, mission_index), std::numeric_limits<int>::max());
+    }
+
+    qint64 bytes = 0;
+    if (!file::saveStream(path, *_mission, entries, _reader.get(), &bytes)) return false;
+    qInfo() << "MissionManager" << __func__ << path << bytes << "bytes written in" << timer.nsecsElapsed() / 1e6
+            << "ms";
+
+    auto reader = std::make_shared<file::StreamReader>(path);
+    if (!reader->open() || !reader->hasIndex()) {
+        qWarning() << "MissionManager" << __func__ << "reopening" << path << "fail";
+        return true;
+    }
+
+    // The components are now the records of the saved file, in order.
+    _reader = reader;
+    for (int row = 0; row < _entries.count(); row++) {
+        _entries[row] = row;
+    }
+    if (!_pending.isEmpty()) {
+        QHash<const google::protobuf::Message *, Pending> pending;
+        for (int row = 0; row < _mission->components_size(); row++) {
+            const auto &component = _mission->components(row);
+            if (!component.has_collection()) continue;
+
+            const auto &it = _pending.constFind(&component.collection());
+            if (it != _pending.cend()) pending.insert(&component.collection(), {row, it->loaded});
+        }
+        _pending.swap(pending);
+    }
+    mission_item->backend().clearDirty();
+
+    // The edits saved are no longer journaled, the journal of the former file
+    // is dropped when the mission is saved elsewhere.
+    if (_journal.isOpen() && QFileInfo(_journal.fileName()).canonicalFilePath() !=
+                                 QFileInfo(path + ".journal").canonicalFilePath()) {
+        _journal.discard();
+    }
+    openJournal(false);
+    return true;
 }
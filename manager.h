@@ -5,14 +5,27 @@
 // === Include
 // ============================================================================ //
 
+#include "core/history.h"
+#include "core/journal.h"
+#include "core/loader.h"
+#include "core/snapshot.h"
+#include "core/stats.h"
 #include "private/model.h"
 #include "protobuf/mission.pb.h"
 
+#include <QElapsedTimer>
+#include <QHash>
+#include <QTimer>
+
+#include <google/protobuf/arena.h>
+
+#include <memory>
+
 // ===
 // === Class
 // ============================================================================ //
 
-class MissionManager : public QObject
+class MissionManager : public QObject, private MissionSource
 {
     Q_OBJECT
 
@@ -21,17 +34,87 @@ class MissionManager : public QObject
     ~MissionManager();
 
     MissionModel *model() { return &_model; }
-    void loadMission(pb::mission::Mission *mission);
+    void loadMission(std::unique_ptr<pb::mission::Mission> mission);
+    bool openFile(const QString &path);
+    bool saveFile(const QString &path);
+    bool isModified() const;
 
     void remove(const QModelIndex &index);
+    void remove(const QModelIndexList &indexes);
     void addPoint(const QModelIndex &parent);
     void addRail(const QModelIndex &parent);
 
+    bool canUndo() const { return _history.canUndo(); }
+    bool canRedo() const { return _history.canRedo(); }
+    void undo();
+    void redo();
+    MissionHistory &history() { return _history; }
+
+    MissionSnapshot snapshot();
+    bool restoreSnapshot(const MissionSnapshot &snapshot);
+
+    bool isLoading() const { return _loader != nullptr; }
+    void cancelLoad();
+
+    stats::Snapshot stats() const;
+    void dumpStats(const QString &path, int interval);
+
+  signals:
+    void loadStarted();
+    void loadProgress(qint64 done, qint64 total);
+    void loadFinished(bool success);
+    void loadCanceled();
+
   private:
-    pb::mission::Mission _mission;
+    struct Pending {
+        int component;
+        int loaded;
+    };
+
+    int pendingCount(const google::protobuf::Message *protobuf) const override;
+    void loadPending(google::protobuf::Message *protobuf, int count) override;
+    bool removeRows(int row, int count, const QModelIndex &parent, QVector<QByteArray> *messages = nullptr);
+    bool insertRows(int row, const QVector<QByteArray> &messages, const QModelIndex &parent);
+    void addPoint(const QModelIndex &parent, const QString &name);
+    void addRail(const QModelIndex &parent, const QString &name);
+    QVector<int> pathOf(const QModelIndex &index) const;
+    QModelIndex indexOf(const QVector<int> &path);
+    void fetchRows(const QModelIndex &parent, int count);
+    void journal(pb::mission::MissionEdit::Type type, const QModelIndex &parent, int row, int count,
+                 const QString &name = QString(), const QVector<QByteArray> &messages = QVector<QByteArray>());
+    void openJournal(bool is_replayed);
+    void loadAllPending();
+    void applyEdit(const pb::mission::MissionEdit &edit);
+    bool isRecorded() const { return !_is_replaying && !_is_undoing; }
+    void record(MissionHistory::Change::Type type, const QModelIndex &parent, int row, int count,
+                const QVector<QByteArray> &messages = QVector<QByteArray>());
+    bool applyChange(MissionHistory::Change *change, bool is_undone);
+    void writeStats();
+
+    std::unique_ptr<google::protobuf::Arena> _arena;
+    std::unique_ptr<google::protobuf::Arena> _load_arena;
+    pb::mission::Mission *_mission;
     void newMission();
     void clearMission();
+    google::protobuf::Arena *createLoadArena();
+    void startLoader(MissionLoader *loader);
+    void showMission();
+    void appendComponents();
+    void finishLoad();
     MissionModel _model;
+    std::unique_ptr<MissionLoader> _loader;
+    QElapsedTimer _load_elapsed;
+    std::shared_ptr<const file::StreamReader> _reader;
+    QHash<const google::protobuf::Message *, Pending> _pending;
+    int _read_components;
+    QVector<int> _entries;
+    MissionJournal _journal;
+    bool _is_replaying;
+    MissionHistory _history;
+    bool _is_undoing;
+    MissionSnapshotBuilder _snapshots;
+    QTimer _stats_timer;
+    QString _stats_path;
 };
 
 #endif // RTSYS_MISSION_MANAGER_H
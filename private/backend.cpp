@@ -3,132 +3,119 @@
 // ============================================================================ //
 
 #include "private/backend.h"
+#include "core/stats.h"
 #include "private/model.h"
-#include "private/model_misc.h"
-#include "protobuf/mission.pb.h"
 
 #include <QDebug>
-#include <QIcon>
-
-// ===
-// === Define
-// ============================================================================ //
-
-const auto ResourceIconMission = QStringLiteral(":/resource/mission.svg");
-const auto ResourceIconCollection = QStringLiteral(":/resource/collection.svg");
-const auto ResourceIconRoute = QStringLiteral(":/resource/route.svg");
-const auto ResourceIconFamily = QStringLiteral(":/resource/family.svg");
-const auto ResourceIconRail = QStringLiteral(":/resource/rail.svg");
-const auto ResourceIconSegment = QStringLiteral(":/resource/segment.svg");
-const auto ResourceIconPoint = QStringLiteral(":/resource/point.png");
-const auto ResourceIconRailPoint = QStringLiteral(":/resource/rail.png");
-
-const auto ComponentTypeMission = pb::mission::Mission::descriptor() -> name();
-const auto ComponentTypeCollection = pb::mission::Mission::Collection::descriptor() -> name();
-const auto ComponentTypePoint = pb::mission::Mission::Element::Point::descriptor() -> name();
-const auto ComponentTypeRail = pb::mission::Mission::Element::Rail::descriptor() -> name();
-const auto ComponentTypeSegment = pb::mission::Mission::Element::Segment::descriptor() -> name();
 
 // ===
 // === Class
 // ============================================================================ //
 
+// The component type is worked out once here and then cached, so that the hot
+// paths (icon, maskEnableAction, ...) never have to look at the descriptor.
+// The protobuf children are counted once here as well, the counters are then
+// kept up to date by the mutating methods (add, remove, ...). Counting doesn't
+// need any item, so it holds even if the children items aren't fetched yet.
 MissionBackend::MissionBackend(google::protobuf::Message *protobuf, MissionItem *item)
     : _protobuf(protobuf)
     , _item(item)
+    , _component(mission::componentTypeOf(protobuf))
+    , _dirty(false)
+    , _childsCount{0, 0, 0}
 {
+    if (_component == mission::kMission) {
+        for (const auto &component : static_cast<pb::mission::Mission *>(_protobuf)->components()) {
+            countChild(mission::componentTypeOf(component), 1);
+        }
+    } else if (_component == mission::kCollection) {
+        for (const auto &element : static_cast<pb::mission::Mission::Collection *>(_protobuf)->elements()) {
+            countChild(mission::componentTypeOf(element), 1);
+        }
+    } else if (_component == mission::kRail || _component == mission::kSegment) {
+        countChild(mission::kPoint, 2);
+    }
 }
 
 MissionBackend::~MissionBackend() {}
 
-// Returns the component type of the underlying protobuf message.
-// The component type is figured out by looking at the protobuf message
-// descriptor and then check for name matching.
-MissionBackend::Component MissionBackend::componentType() const
-{
-    if (!_protobuf) return Component::kNoComponent;
-
-    const auto &name = _protobuf->GetDescriptor()->name();
-    if (name == ComponentTypeMission) return Component::kMission;
-    if (name == ComponentTypeCollection) return Component::kCollection;
-    if (name == ComponentTypePoint) return Component::kPoint;
-    if (name == ComponentTypeRail) return Component::kRail;
-    if (name == ComponentTypeSegment) return Component::kSegment;
-    return Component::kNoComponent;
-}
-
 // Returns the item parent component type of parent the underlying protobuf
 // message.
 MissionBackend::Component MissionBackend::parentComponentType() const
 {
-    if (!_item || !_item->parent()) return Component::kNoComponent;
+    if (!_item || !_item->parent()) return mission::kNoComponent;
 
     return _item->parent()->backend().componentType();
 }
 
-// Returns the collection type of the underlying protobuf message.
-// The collection type is figured out by looking at the item children
-// component type.
-//  - A Route is a collection of Point.
-//  - A Family is a collection of Rail.
-MissionBackend::Collection MissionBackend::collectionType() const
+// Returns the name of the underlying protobuf message. The name is returned
+// by reference so that nothing is copied nor converted here.
+const std::string &MissionBackend::name() const
+{
+    return mission::nameOf(_protobuf, _component);
+}
+
+// Returns the number of children of the underlying protobuf message, whether
+// or not their items have been fetched.
+int MissionBackend::childCount() const
 {
-    if (!_item) return Collection::kScenario;
+    return mission::childCountOf(_protobuf, _component);
+}
 
-    auto is_route = true;
-    auto is_family = true;
-    for (auto *child_item : _item->childs()) {
-        const auto &component_type = child_item->backend().componentType();
-        is_route &= component_type == Component::kPoint;
-        is_family &= component_type == Component::kRail;
+// Returns the number of children of the underlying protobuf message of the
+// specified component type. Only the Point, Rail and Segment children are
+// counted, so any other component type returns zero.
+int MissionBackend::childCount(const Component component) const
+{
+    if (component >= mission::kPoint && component <= mission::kSegment) {
+        return _childsCount[component - mission::kPoint];
     }
-    if (is_route) return Collection::kRoute;
-    if (is_family) return Collection::kFamily;
-    return Collection::kScenario;
+    return 0;
 }
 
-// Returns the representing icon of the underlying protobuf message.
-// The icon is figured out by looking at the componenet and collection type.
-QVariant MissionBackend::icon() const
+// Updates the number of children of the specified component type.
+void MissionBackend::countChild(const Component component, const int increment)
 {
-    const auto &component_type = componentType();
-    if (component_type == Component::kMission) {
-        return QIcon(ResourceIconMission);
-    } else if (component_type == Component::kCollection) {
-        const auto &collection_type = collectionType();
-        if (collection_type == Collection::kRoute) return QIcon(ResourceIconRoute);
-        if (collection_type == Collection::kFamily) return QIcon(ResourceIconFamily);
-        return QIcon(ResourceIconCollection);
-    } else if (component_type == Component::kRail) {
-        return QIcon(ResourceIconRail);
-    } else if (component_type == Component::kSegment) {
-        return QIcon(ResourceIconSegment);
-    } else if (component_type == Component::kPoint) {
-        const auto &parent_component_type = parentComponentType();
-        if (parent_component_type == Component::kRail) return QIcon(ResourceIconRailPoint);
-        if (parent_component_type == Component::kSegment) return QIcon(ResourceIconRailPoint);
-        return QIcon(ResourceIconPoint);
+    if (component >= mission::kPoint && component <= mission::kSegment) {
+        _childsCount[component - mission::kPoint] += increment;
     }
-    return QVariant();
+}
+
+// Returns the collection type of the underlying protobuf message.
+// The collection type is figured out by looking at the number of children of
+// each component type the backend keeps up to date.
+//  - A Route is a collection of Point.
+//  - A Family is a collection of Rail.
+MissionBackend::Collection MissionBackend::collectionType() const
+{
+    const auto &count = childCount();
+    if (childCount(mission::kPoint) == count) return mission::kRoute;
+    if (childCount(mission::kRail) == count) return mission::kFamily;
+    return mission::kScenario;
 }
 
 // Returns the mask of the enabled action depending on the component type of
-// the underlying protobuf message.
+// the underlying protobuf message. The placeholder of a component or an element
+// whose oneof isn't set can only be deleted, unlike the root item which has no
+// protobuf message at all.
 unsigned int MissionBackend::maskEnableAction() const
 {
+    MISSION_STATS_PROBE(kBackendMaskEnableAction);
     const auto &component_type = componentType();
-    if (component_type == MissionBackend::kMission) {
+    if (component_type == mission::kMission) {
         // return (1 << kDelete) | (1 << kAddPoint) | (1 << kAddRail) | (1 << kAddSegment) | (1 << kAddCollection);
         return (1 << kAddPoint) | (1 << kAddRail) | (1 << kAddSegment) | (1 << kAddCollection);
-    } else if (component_type == MissionBackend::kCollection) {
+    } else if (component_type == mission::kCollection) {
         return (1 << kDelete) | (1 << kAddPoint) | (1 << kAddRail) | (1 << kAddSegment);
-    } else if (component_type == MissionBackend::kRail || component_type == MissionBackend::kSegment) {
+    } else if (component_type == mission::kRail || component_type == mission::kSegment) {
         return (1 << kDelete);
-    } else if (component_type == MissionBackend::kPoint) {
+    } else if (component_type == mission::kPoint) {
         const auto &parent_component_type = parentComponentType();
-        if (parent_component_type != MissionBackend::kRail && parent_component_type != MissionBackend::kSegment) {
+        if (parent_component_type != mission::kRail && parent_component_type != mission::kSegment) {
             return (1 << kDelete);
         }
+    } else if (component_type == mission::kNoComponent && _protobuf) {
+        return (1 << kDelete);
     }
     return 0;
 }
@@ -138,39 +125,84 @@ void MissionBackend::clear()
 {
     if (!_protobuf) return;
     _protobuf->Clear();
+    if (_component == mission::kMission || _component == mission::kCollection) {
+        _childsCount[0] = _childsCount[1] = _childsCount[2] = 0;
+    }
+    setDirty();
 }
 
-// Remove the component type of the underlying protobuf message.
-// Depending on the component type, we remove the row-element of the component
-// type list. This is done by first swapping the elements and then removing
-// the last element of the component type list.
-void MissionBackend::remove(const int row)
+// Marks the underlying protobuf message as changed since the mission was last
+// saved, along with its ancestors: the dirty flag of a top-level component
+// tells whether it has to be serialized again. This is set by every mutating
+// path of the backend.
+void MissionBackend::setDirty()
 {
-    const auto &component_type = componentType();
+    _dirty = true;
+    for (auto *item = _item ? _item->parent() : nullptr; item && !item->backend()._dirty; item = item->parent()) {
+        item->backend()._dirty = true;
+    }
+}
 
-    if (component_type == MissionBackend::kMission) {
-        // Remove the row-element of the components repeated field
-        auto *mission = static_cast<pb::mission::Mission *>(_protobuf);
-        for (int i = row; i < mission->components_size() - 1; i++) {
-            mission->mutable_components()->SwapElements(i, i + 1);
-        }
-        mission->mutable_components()->RemoveLast();
+// Clears the dirty flag of the underlying protobuf message and of its
+// descendants, once the mission is saved. Only the dirty children are visited.
+void MissionBackend::clearDirty()
+{
+    _dirty = false;
+    if (!_item) return;
+
+    for (auto *child : _item->childs()) {
+        if (child->backend()._dirty) child->backend().clearDirty();
+    }
+}
 
-    } else if (component_type == MissionBackend::kCollection) {
-        // Remove the row-element of the collection repeated field
-        auto *collection = static_cast<pb::mission::Mission::Collection *>(_protobuf);
-        for (int i = row; i < collection->elements_size() - 1; i++) {
-            collection->mutable_elements()->SwapElements(i, i + 1);
+// Updates the number of children by component type with the 'count'
+// children of the underlying protobuf message starting at 'row'.
+void MissionBackend::countChilds(const int row, const int count, const int increment)
+{
+    const auto &component_type = componentType();
+    if (component_type == mission::kMission) {
+        const auto &components = static_cast<pb::mission::Mission *>(_protobuf)->components();
+        for (int i = qMax(row, 0); i < row + count && i < components.size(); i++) {
+            countChild(mission::componentTypeOf(components.Get(i)), increment);
+        }
+    } else if (component_type == mission::kCollection) {
+        const auto &elements = static_cast<pb::mission::Mission::Collection *>(_protobuf)->elements();
+        for (int i = qMax(row, 0); i < row + count && i < elements.size(); i++) {
+            countChild(mission::componentTypeOf(elements.Get(i)), increment);
         }
-        collection->mutable_elements()->RemoveLast();
+    }
+}
 
-    } else if (component_type == MissionBackend::kNoComponent) {
-        // In this case we want to remove a top-level item, it means that the
+// Counts the children appended to the underlying protobuf message from the
+// given row on. This is needed when the children are added directly to the
+// protobuf message and not through the backend, like when a mission file is
+// streamed into the mission.
+void MissionBackend::countAppended(const int row)
+{
+    countChilds(row, childCount() - row, 1);
+}
+
+// Remove the component type of the underlying protobuf message.
+// Depending on the component type, we remove the 'count' row-elements starting
+// at 'row' of the component type list (see mission::remove).
+void MissionBackend::remove(const int row, const int count)
+{
+    const auto &component_type = componentType();
+
+    if (component_type == mission::kMission || component_type == mission::kCollection) {
+        // Uncount the row-elements of the repeated field, then remove them
+        if (row < 0 || count <= 0 || row + count > childCount()) return;
+        countChilds(row, count, -1);
+        mission::remove(_protobuf, component_type, row, count);
+        setDirty();
+
+    } else if (component_type == mission::kNoComponent) {
+        // In this case we want to remove top-level items, it means that the
         // current backend is the one for the root item. In order to remove
-        // the row-element we first retrieve the child item specified by the row
-        // and the we clear the underlying protobuf message.
-        if (_item->childCount() >= row) {
-            _item->child(row)->backend().clear();
+        // the row-elements we first retrieve the child items specified by the
+        // rows and then we clear their underlying protobuf message.
+        for (int i = row; i < row + count && i < _item->childCount(); i++) {
+            _item->child(i)->backend().clear();
         }
 
     } else {
@@ -178,41 +210,40 @@ void MissionBackend::remove(const int row)
     }
 }
 
+// Inserts the given serialized messages at the given row of the underlying
+// protobuf message, in one range insertion (see mission::insert). The messages
+// are components under the mission and elements under a collection.
+bool MissionBackend::insert(const int row, const QVector<QByteArray> &messages)
+{
+    if (!mission::insert(_protobuf, componentType(), row, messages)) return false;
+
+    countChilds(row, messages.count(), 1);
+    setDirty();
+    return true;
+}
+
 // Adds a point protobuf message under the underlying protobuf message.
 // Depending on the component type, the point is added either into the
-// componenet or the collection.
+// componenet or the collection (see mission::addPoint).
 google::protobuf::Message *MissionBackend::addPoint()
 {
-    pb::mission::Mission::Element::Point *point = nullptr;
-    const auto &component_type = componentType();
-    if (component_type == MissionBackend::kMission) {
-        point = static_cast<pb::mission::Mission *>(_protobuf)->add_components()->mutable_element()->mutable_point();
-    } else if (component_type == MissionBackend::kCollection) {
-        point = static_cast<pb::mission::Mission::Collection *>(_protobuf)->add_elements()->mutable_point();
-    } else {
-        qWarning() << "MissionBackend" << __func__ << "adding point not implemented for component type"
-                   << component_type;
-        return point;
+    auto *point = mission::addPoint(_protobuf, componentType());
+    if (point) {
+        countChild(mission::kPoint, 1);
+        setDirty();
     }
-
-    point->set_name(QString("Point %1").arg(_item->parent()->childCount()).toStdString());
-    misc::appendItem(point, _item->parent());
     return point;
 }
 
 // Adds a rail protobuf message under the underlying protobuf message.
 // Depending on the component type, the rail is added either into the
-// componenet or the collection.
+// componenet or the collection (see mission::addRail).
 google::protobuf::Message *MissionBackend::addRail()
 {
-    const auto &component_type = componentType();
-    if (component_type == MissionBackend::kMission) {
-        return static_cast<pb::mission::Mission *>(_protobuf)->add_components()->mutable_element()->mutable_rail();
-    } else if (component_type == MissionBackend::kCollection) {
-        return static_cast<pb::mission::Mission::Collection *>(_protobuf)->add_elements()->mutable_rail();
-    } else {
-        qWarning() << "MissionBackend" << __func__ << "adding rail not implemented for component type"
-                   << component_type;
-        return nullptr;
+    auto *rail = mission::addRail(_protobuf, componentType());
+    if (rail) {
+        countChild(mission::kRail, 1);
+        setDirty();
     }
+    return rail;
 }
@@ -5,53 +5,65 @@
 // === Include
 // ============================================================================ //
 
-#include <QVariant>
+#include "core/mission.h"
+
+#include <string>
 
 // ===
 // === Define
 // ============================================================================ //
 
-namespace google {
-namespace protobuf {
-class Message;
-} // namespace protobuf
-} // namespace google
-
 class MissionItem;
 
 // ===
 // === Class
 // ============================================================================ //
 
-// This defines the backend of the mission.
+// This defines the backend of the mission. It adapts the headless mission API
+// (see core/mission.h) to the items of the model: it keeps the component type
+// and the children counts of its protobuf message and the dirty flags.
 class MissionBackend
 {
   public:
-    enum Component { kMission, kCollection, kPoint, kRail, kSegment, kNoComponent };
-    enum Collection { kScenario, kRoute, kFamily };
+    typedef mission::Component Component;
+    typedef mission::Collection Collection;
     enum Action { kDelete, kAddPoint, kAddRail, kAddSegment, kAddCollection };
 
   public:
     explicit MissionBackend(google::protobuf::Message *protobuf = nullptr, MissionItem *item = nullptr);
     ~MissionBackend();
 
-    QVariant icon() const;
     unsigned int maskEnableAction() const;
     bool hasEnableAction(const Action action) const { return hasEnableAction(action, maskEnableAction()); }
     bool hasEnableAction(const Action action, const unsigned int mask) const { return (mask >> action) & 1; }
 
-    void remove(const int row);
+    void remove(const int row, const int count = 1);
+    bool insert(const int row, const QVector<QByteArray> &messages);
     void clear();
+    void countAppended(const int row);
+    bool isDirty() const { return _dirty; }
+    void setDirty();
+    void clearDirty();
     google::protobuf::Message *addPoint();
     google::protobuf::Message *addRail();
 
-  private:
-    Component componentType() const;
+    Component componentType() const { return _component; }
+    google::protobuf::Message *protobuf() const { return _protobuf; }
+    const std::string &name() const;
+    int childCount() const;
+    int childCount(const Component component) const;
     Collection collectionType() const;
     Component parentComponentType() const;
 
+  private:
+    void countChild(const Component component, const int increment);
+    void countChilds(const int row, const int count, const int increment);
+
     google::protobuf::Message *_protobuf;
     MissionItem *_item;
+    Component _component;
+    bool _dirty;
+    int _childsCount[3]; // Point, Rail and Segment children
 };
 
 #endif // RTSYS_MISSION_BACKEND_H
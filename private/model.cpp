@@ -3,40 +3,174 @@
 // ============================================================================ //
 
 #include "private/model.h"
+#include "core/stats.h"
+#include "private/model_misc.h"
 #include "protobuf/mission.pb.h"
 
 #include <QDebug>
 #include <QIcon>
 
+#include <algorithm>
+
 #define CastToItem(index) static_cast<MissionItem *>(index.internalPointer())
 
+// The maximum number of children items created by one fetch. Very large
+// collections are then fetched progressively while the view is scrolled.
+const int FetchBatchSize = 1000;
+
+// The names displayed in the component column, indexed by component type.
+const QString ComponentNames[] = {
+    QStringLiteral("Mission"), QStringLiteral("Collection"), QStringLiteral("Point"),
+    QStringLiteral("Rail"),    QStringLiteral("Segment"),    QString(),
+};
+
+// This defines the icons representing the protobuf messages. The resource
+// of each icon is given by the array below, in the same order.
+enum Icon {
+    kIconMission,
+    kIconCollection,
+    kIconRoute,
+    kIconFamily,
+    kIconRail,
+    kIconSegment,
+    kIconPoint,
+    kIconRailPoint
+};
+
+const char *const ResourceIcons[] = {
+    ":/resource/mission.svg", ":/resource/collection.svg", ":/resource/route.svg", ":/resource/family.svg",
+    ":/resource/rail.svg",    ":/resource/segment.svg",    ":/resource/point.png", ":/resource/rail.png",
+};
+
+// The sizes the icons are rasterized at, the small icon size used by the tree
+// view and its high dpi counterpart.
+const int IconSizes[] = {16, 32};
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns the cached icon specified by the given icon type. The cache is
+// shared by the whole process and is built on the first call (it requires
+// the gui application to exist). Each resource is looked up and parsed once
+// and its pixmaps are pre-rendered at the sizes used by the tree view, so
+// painting never has to rasterize the resource again.
+static const QVariant &cachedIcon(Icon icon)
+{
+    static const auto cache = []() {
+        QVector<QVariant> cache;
+        for (const auto *resource : ResourceIcons) {
+            const QIcon source(QString::fromLatin1(resource));
+            QIcon rasterized;
+            for (const auto &size : IconSizes) {
+                rasterized.addPixmap(source.pixmap(QSize(size, size)));
+            }
+            cache.append(rasterized);
+        }
+        return cache;
+    }();
+    return cache.at(icon);
+}
+
+// Returns the representing icon of the protobuf message of the given item.
+// The icon is figured out by looking at the componenet, collection and parent
+// component type, then it is served from the shared icon cache.
+static const QVariant &iconOf(MissionItem *item)
+{
+    MISSION_STATS_PROBE(kBackendIcon);
+    static const QVariant no_icon;
+
+    const auto &backend = item->backend();
+    const auto &component_type = backend.componentType();
+    if (component_type == mission::kMission) {
+        return cachedIcon(kIconMission);
+    } else if (component_type == mission::kCollection) {
+        const auto &collection_type = backend.collectionType();
+        if (collection_type == mission::kRoute) return cachedIcon(kIconRoute);
+        if (collection_type == mission::kFamily) return cachedIcon(kIconFamily);
+        return cachedIcon(kIconCollection);
+    } else if (component_type == mission::kRail) {
+        return cachedIcon(kIconRail);
+    } else if (component_type == mission::kSegment) {
+        return cachedIcon(kIconSegment);
+    } else if (component_type == mission::kPoint) {
+        const auto &parent_component_type = backend.parentComponentType();
+        if (parent_component_type == mission::kRail) return cachedIcon(kIconRailPoint);
+        if (parent_component_type == mission::kSegment) return cachedIcon(kIconRailPoint);
+        return cachedIcon(kIconPoint);
+    }
+    return no_icon;
+}
+
 // ===
 // === Class
 // ============================================================================ //
 
-MissionItem::MissionItem(const QVector<QVariant> &data, google::protobuf::Message *protobuf, MissionItem *parent)
-    : _data(data)
-    , _parent(parent)
+MissionItem::MissionItem(google::protobuf::Message *protobuf, MissionItem *parent)
+    : _parent(parent)
+    , _row(0)
     , _backend(protobuf, this)
 {
 }
 
-MissionItem::~MissionItem()
+MissionItem::~MissionItem() {}
+
+// Appends the child at the end of the children. The child row is simply the
+// number of children before the appending, no other child is renumbered.
+void MissionItem::appendChild(MissionItem *child)
+{
+    child->_row = _childs.count();
+    _childs.append(child);
+}
+
+// Inserts the child at the specified row. The children following the
+// inserted one are shifted by one, so only them are renumbered.
+void MissionItem::insertChild(int row, MissionItem *child)
 {
-    qDeleteAll(_childs);
+    _childs.insert(row, child);
+    renumberChilds(row, _childs.count() - 1);
 }
 
-// Removes the child specified by the given row. This also removes the
-// underlying protobuf data through the backend.
-void MissionItem::removeChild(int row)
+// Inserts the given children at the specified row at once. The children
+// following the inserted ones are shifted, they are renumbered only once.
+void MissionItem::insertChilds(int row, const QVector<MissionItem *> &childs)
 {
-    if (row < 0 || row >= _childs.size()) return;
+    if (row < 0 || row > _childs.count() || childs.isEmpty()) return;
 
-    _backend.remove(row);
-    auto *pointer = child(row);
-    _childs.remove(row);
-    delete pointer;
-    pointer = nullptr;
+    _childs.insert(row, childs.count(), nullptr);
+    std::copy(childs.cbegin(), childs.cend(), _childs.begin() + row);
+    renumberChilds(row, _childs.count() - 1);
+}
+
+// Removes the 'count' children starting at the given row. This also removes
+// the underlying protobuf data through the backend, in one range deletion.
+// The removed children aren't destroyed, the caller is responsible for it.
+void MissionItem::removeChilds(int row, int count)
+{
+    if (row < 0 || count <= 0 || row + count > _childs.size()) return;
+
+    _backend.remove(row, count);
+    _childs.remove(row, count);
+    renumberChilds(row, _childs.count() - 1);
+}
+
+// Moves the child specified by the row 'from' to the row 'to'. Only the
+// children between both rows are renumbered.
+void MissionItem::moveChild(int from, int to)
+{
+    if (from < 0 || from >= _childs.size() || to < 0 || to >= _childs.size() || from == to) return;
+
+    _childs.move(from, to);
+    renumberChilds(qMin(from, to), qMax(from, to));
+}
+
+// Renumbers the children between the rows 'first' and 'last' (inclusive) so
+// that their stored row matches their position in the children list.
+void MissionItem::renumberChilds(int first, int last)
+{
+    for (int i = first; i <= last; i++) {
+        _childs.at(i)->_row = i;
+    }
 }
 
 // Return the child specified by the given row.
@@ -47,36 +181,38 @@ MissionItem *MissionItem::child(int row)
     return _childs.at(row);
 }
 
-// Returns the data specified by the column.
+// Returns the data specified by the column. The component name comes from a
+// shared table and the name is converted from the underlying protobuf message
+// only when asked.
 QVariant MissionItem::data(int column) const
 {
-    if (column < 0 || column >= _data.size()) {
-        return QVariant();
-    }
-    return _data.at(column);
-}
-
-// Returns the number of rows of the item, it means that row is returning
-// the number of its children.
-int MissionItem::row() const
-{
-    if (_parent) {
-        return _parent->_childs.indexOf(const_cast<MissionItem *>(this));
-    }
-    return 0;
+    if (column == kComponentColumn) return ComponentNames[_backend.componentType()];
+    if (column == kNameColumn) return QString::fromStdString(_backend.name());
+    return QVariant();
 }
 
 // ============================================================================ //
 
 MissionModel::MissionModel(QObject *parent)
     : QAbstractItemModel(parent)
-    , _root(new MissionItem({tr("Component"), tr("Name")}))
+    , _root(_pool.create())
+    , _source(nullptr)
 {
 }
 
 MissionModel::~MissionModel()
 {
-    delete _root;
+    destroy(_root);
+}
+
+// Destroys the given item and all its children items, their slots are given
+// back to the pool.
+void MissionModel::destroy(MissionItem *item)
+{
+    for (auto *child : item->childs()) {
+        destroy(child);
+    }
+    _pool.destroy(item);
 }
 
 // Returns the item flags for the given index.
@@ -88,6 +224,7 @@ Qt::ItemFlags MissionModel::flags(const QModelIndex &index) const
 // Returns the data stored under the given role for the specified index.
 QVariant MissionModel::data(const QModelIndex &index, int role) const
 {
+    MISSION_STATS_PROBE(kModelData);
     if (!index.isValid()) return QVariant();
 
     auto *item = CastToItem(index);
@@ -98,7 +235,7 @@ QVariant MissionModel::data(const QModelIndex &index, int role) const
 
     if (role == Qt::DecorationRole) {
         if (index.column() == 0) {
-            return item->backend().icon();
+            return iconOf(item);
         };
     }
 
@@ -109,28 +246,33 @@ QVariant MissionModel::data(const QModelIndex &index, int role) const
 QVariant MissionModel::headerData(int section, Qt::Orientation orientation, int role) const
 {
     if (orientation == Qt::Horizontal && role == Qt::DisplayRole) {
-        return _root->data(section);
+        if (section == MissionItem::kComponentColumn) return tr("Component");
+        if (section == MissionItem::kNameColumn) return tr("Name");
     }
     return QVariant();
 }
 
 // Returns the number of rows under the given parent index. When the parent
 // index is valid it means that rowCount is returning the number of children
-// of parent index.
+// of parent index. Only the fetched children are counted.
 int MissionModel::rowCount(const QModelIndex &parent) const
 {
+    MISSION_STATS_PROBE(kModelRowCount);
     return (parent.isValid() ? CastToItem(parent) : _root)->childCount();
 }
 
 // Returns the number of columns for the children of the given parent index.
+// All the items share the same columns.
 int MissionModel::columnCount(const QModelIndex &parent) const
 {
-    return parent.isValid() ? CastToItem(parent)->columnCount() : _root->columnCount();
+    Q_UNUSED(parent);
+    return MissionItem::kColumnCount;
 }
 
 // Creates then returns the index specified by the given row, column and parent index.
 QModelIndex MissionModel::index(int row, int column, const QModelIndex &parent) const
 {
+    MISSION_STATS_PROBE(kModelIndex);
     if (!hasIndex(row, column, parent)) return QModelIndex();
 
     auto *parent_item = parent.isValid() ? CastToItem(parent) : _root;
@@ -159,22 +301,155 @@ MissionItem *MissionModel::item(const QModelIndex &index) const
 // Creates then returns the parent index of the child index.
 QModelIndex MissionModel::parent(const QModelIndex &child) const
 {
+    MISSION_STATS_PROBE(kModelParent);
     if (child.isValid()) {
         return index(CastToItem(child)->parent(), 0);
     }
     return QModelIndex();
 }
 
-// Remove the index specified by the given row and parent index. When the
-// parent index isn't valid it means that we try removing top-level item so
-// we set the parent item to the root item.
-void MissionModel::removeRow(int row, const QModelIndex &parent)
+// Returns true if the given parent index has children, whether or not they
+// have been fetched. This lets the view show the expand indicator of items
+// whose children are created lazily.
+bool MissionModel::hasChildren(const QModelIndex &parent) const
+{
+    if (!parent.isValid()) return _root->childCount() > 0;
+
+    auto *parent_item = CastToItem(parent);
+    return parent_item->childCount() > 0 || parent_item->backend().childCount() > 0 || pendingCount(parent_item) > 0;
+}
+
+// Returns true if the underlying protobuf message of the given parent index
+// has more children than its item, or children not loaded yet.
+bool MissionModel::canFetchMore(const QModelIndex &parent) const
+{
+    if (!parent.isValid()) return false;
+
+    auto *parent_item = CastToItem(parent);
+    return parent_item->childCount() < parent_item->backend().childCount() || pendingCount(parent_item) > 0;
+}
+
+// Creates the next batch of children items of the given parent index from its
+// underlying protobuf message. The view calls it when the parent is expanded
+// and again when it is scrolled to the end of the fetched children. The
+// children of the batch not loaded yet into the protobuf message are loaded
+// first.
+void MissionModel::fetchMore(const QModelIndex &parent)
+{
+    if (!parent.isValid()) return;
+
+    auto *parent_item = CastToItem(parent);
+    const auto &first = parent_item->childCount();
+    fetchPending(parent, first + FetchBatchSize - parent_item->backend().childCount());
+    const auto &last = qMin(parent_item->backend().childCount(), first + FetchBatchSize) - 1;
+    if (last < first) return;
+
+    beginInsertRows(parent, first, last);
+    for (int row = first; row <= last; row++) {
+        misc::fetchChild(_pool, parent_item, row);
+    }
+    endInsertRows();
+}
+
+// Loads the next 'count' children not loaded yet into the underlying protobuf
+// message of the given parent index, at most. The children are loaded by the
+// source, after the loaded ones, and their items are fetched later on. As the
+// parent decoration depends on its children (route, family, ...), the parent
+// is notified as changed.
+void MissionModel::fetchPending(const QModelIndex &parent, int count)
+{
+    if (!parent.isValid() || count <= 0) return;
+
+    auto *parent_item = CastToItem(parent);
+    if (!pendingCount(parent_item)) return;
+
+    auto &backend = parent_item->backend();
+    const auto &row = backend.childCount();
+    _source->loadPending(backend.protobuf(), count);
+    backend.countAppended(row);
+    emit dataChanged(parent, parent, {Qt::DecorationRole});
+}
+
+// Returns the number of children not loaded yet into the underlying protobuf
+// message of the given item.
+int MissionModel::pendingCount(MissionItem *item) const
+{
+    return _source ? _source->pendingCount(item->backend().protobuf()) : 0;
+}
+
+// Appends the rows of the 'count' protobuf messages that have just been added
+// at the end of the parent index protobuf message. When the parent children
+// were all fetched the items are created (one fetch batch at most, with a
+// single notification), otherwise the protobuf messages join the not yet
+// fetched children. As the parent decoration depends on its children (route,
+// family, ...), the parent is notified as changed.
+void MissionModel::appendRows(const QModelIndex &parent, int count)
+{
+    auto *parent_item = parent.isValid() ? CastToItem(parent) : _root;
+
+    if (parent_item->childCount() == parent_item->backend().childCount() - count) {
+        fetchMore(parent);
+    }
+    if (parent.isValid()) emit dataChanged(parent, parent, {Qt::DecorationRole});
+}
+
+// Inserts the rows of the 'count' protobuf messages that have just been
+// inserted at the given row of the parent index protobuf message. The items
+// are created, with a single notification, when the rows are among the
+// fetched children or right after them once all of them were fetched;
+// otherwise the protobuf messages join the not yet fetched children. As the
+// parent decoration depends on its children (route, family, ...), the parent
+// is notified as changed.
+void MissionModel::insertRange(const QModelIndex &parent, int row, int count)
 {
     auto *parent_item = parent.isValid() ? CastToItem(parent) : _root;
+    const auto &fetched = parent_item->childCount();
 
-    if (rowCount(parent) && rowCount(parent) >= row) {
-        beginRemoveRows(parent, parent.row(), parent.row() + 1);
-        parent_item->removeChild(row);
-        endRemoveRows();
+    if (count > 0 && (row < fetched || (row == fetched && fetched == parent_item->backend().childCount() - count))) {
+        QVector<MissionItem *> childs;
+        childs.reserve(count);
+        for (int i = row; i < row + count; i++) {
+            childs.append(misc::createChild(_pool, parent_item, i));
+        }
+        beginInsertRows(parent, row, row + count - 1);
+        parent_item->insertChilds(row, childs);
+        endInsertRows();
     }
+    if (parent.isValid()) emit dataChanged(parent, parent, {Qt::DecorationRole});
+}
+
+// Remove the 'count' indexes starting at the given row under the parent index.
+// When the parent index isn't valid it means that we try removing top-level
+// items so we set the parent item to the root item. The whole range is
+// removed with a single notification and a single protobuf range deletion. As
+// the parent decoration depends on its children (route, family, ...), the
+// parent is notified as changed.
+bool MissionModel::removeRows(int row, int count, const QModelIndex &parent)
+{
+    auto *parent_item = parent.isValid() ? CastToItem(parent) : _root;
+
+    if (row < 0 || count <= 0 || row + count > rowCount(parent)) return false;
+
+    const auto removed = parent_item->childs().mid(row, count);
+    beginRemoveRows(parent, row, row + count - 1);
+    parent_item->removeChilds(row, count);
+    for (auto *item : removed) {
+        destroy(item);
+    }
+    endRemoveRows();
+    if (parent.isValid()) emit dataChanged(parent, parent, {Qt::DecorationRole});
+    return true;
+}
+
+// Removes all the items of the model at once. The underlying protobuf
+// messages are left untouched, their owner is responsible for releasing them.
+// Once the items are destroyed the pool is reset, so that the next load reuses
+// its slabs from the start and not in the free list order.
+void MissionModel::clear()
+{
+    beginResetModel();
+    destroy(_root);
+    _pool.reset();
+    _root = _pool.create();
+    endResetModel();
 }
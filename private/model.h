@@ -6,6 +6,7 @@
 // ============================================================================ //
 
 #include "private/backend.h"
+#include "private/pool.h"
 
 #include <QAbstractItemModel>
 #include <QModelIndex>
@@ -16,43 +17,70 @@
 // ============================================================================ //
 
 // This defines the mission item. It represents one item of the mission tree.
-// Each one holds a reference to their parent and to their children. The parent
-// reference is weak so that it isn't responsible for deleting it. The children
-// reference is strong so that it is responsible for deleting them. It holds
-// data '_data', these data are displayed in the tree view.
+// Each one holds a reference to their parent and to their children. Both
+// references are weak, the items are allocated from the pool of the model
+// which is responsible for destroying them. The data
+// displayed in the tree view aren't copied into the item, they are read from
+// the underlying protobuf message when the view asks for them.
 // The backend is responsible of managing the protobuf underlying data.
+// Each item also stores its own row '_row' within its parent, so that the
+// row lookup is constant time. The parent renumbers only the range of
+// children affected by an insertion, a removal or a move.
+// The children are fetched lazily: an item may hold fewer children than its
+// underlying protobuf message, the remaining ones are created on demand by
+// the model (see MissionModel::fetchMore) in the protobuf order.
 class MissionItem
 {
   public:
-    explicit MissionItem(const QVector<QVariant> &data, google::protobuf::Message *protobuf = nullptr,
-                         MissionItem *parent = nullptr);
+    enum Column { kComponentColumn, kNameColumn, kColumnCount };
+
+  public:
+    explicit MissionItem(google::protobuf::Message *protobuf = nullptr, MissionItem *parent = nullptr);
     ~MissionItem();
 
-    void appendChild(MissionItem *child) { _childs.append(child); }
-    void insertChild(int row, MissionItem *child) { _childs.insert(row, child); }
-    void removeChild(int row);
+    void appendChild(MissionItem *child);
+    void insertChild(int row, MissionItem *child);
+    void insertChilds(int row, const QVector<MissionItem *> &childs);
+    void removeChilds(int row, int count);
+    void moveChild(int from, int to);
     MissionItem *child(int row);
     const QVector<MissionItem *> &childs() const { return _childs; }
     int childCount() const { return _childs.count(); }
-    int columnCount() const { return _data.count(); }
     QVariant data(int column) const;
-    int row() const;
+    int row() const { return _row; }
 
     MissionItem *parent() { return _parent; }
     MissionBackend &backend() { return _backend; }
 
   private:
-    QVector<QVariant> _data;
+    void renumberChilds(int first, int last);
+
     MissionItem *_parent;
+    int _row;
     MissionBackend _backend;
     QVector<MissionItem *> _childs;
 };
 
+// This defines the source of the children not loaded yet into the protobuf
+// messages. A protobuf message may be loaded without all of its children, like
+// a large collection of an indexed mission file, the source loads them when the
+// model fetches them.
+class MissionSource
+{
+  public:
+    virtual ~MissionSource() {}
+    virtual int pendingCount(const google::protobuf::Message *protobuf) const = 0;
+    virtual void loadPending(google::protobuf::Message *protobuf, int count) = 0;
+};
 
 // This defines the mission model. The mission model is represented as a tree, each
 // element of the tree (item) is linked to the root item in either parent or child
 // relationship. The items of the tree are instance of 'MissionItem'. In other words
-// the mission model holds all its data through the root item.
+// the mission model holds all its data through the root item. The items are
+// allocated from a pool owned by the model, so that loading, clearing and
+// reloading a mission reuse the same memory slabs. The children not loaded yet
+// into the protobuf messages are loaded from the source of the model, if any,
+// as they are fetched.
 class MissionModel : public QAbstractItemModel
 {
     Q_OBJECT
@@ -71,17 +99,30 @@ class MissionModel : public QAbstractItemModel
     int columnCount(const QModelIndex &parent = QModelIndex()) const override;
     QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
     QModelIndex parent(const QModelIndex &child) const override;
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
+    bool canFetchMore(const QModelIndex &parent) const override;
+    void fetchMore(const QModelIndex &parent) override;
 
     //setData()
 
     template <class T>
     void insertRow(int row, const QModelIndex &parent, T *protobuf = nullptr);
-    void removeRow(int row, const QModelIndex &parent);
+    void appendRows(const QModelIndex &parent, int count = 1);
+    void insertRange(const QModelIndex &parent, int row, int count);
+    bool removeRows(int row, int count, const QModelIndex &parent = QModelIndex()) override;
+    void clear();
     MissionItem *item(const QModelIndex &index) const;
+    MissionPool<MissionItem> &pool() { return _pool; }
+    void setSource(MissionSource *source) { _source = source; }
+    void fetchPending(const QModelIndex &parent, int count);
 
   private:
     QModelIndex index(MissionItem *item, int column) const;
+    int pendingCount(MissionItem *item) const;
+    void destroy(MissionItem *item);
+    MissionPool<MissionItem> _pool;
     MissionItem *_root;
+    MissionSource *_source;
 };
 
 // Create then inserts an item specified by the given row and parent index
@@ -92,10 +133,8 @@ void MissionModel::insertRow(int row, const QModelIndex &parent, T *protobuf)
 {
     auto *parent_item = parent.isValid() ? static_cast<MissionItem *>(parent.internalPointer()) : _root;
 
-    beginInsertRows(parent, row, row + 1);
-    parent_item->insertChild(row, new MissionItem({QString::fromStdString(protobuf->GetDescriptor()->name()),
-                                                   QString::fromStdString(protobuf->name())},
-                                                  protobuf, parent_item));
+    beginInsertRows(parent, row, row);
+    parent_item->insertChild(row, _pool.create(protobuf, parent_item));
     endInsertRows();
 }
 
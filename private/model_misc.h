@@ -15,55 +15,83 @@
 namespace misc {
 
 template <class T>
-inline MissionItem *appendItem(T *protobuf, MissionItem *parent)
+inline MissionItem *createItem(MissionPool<MissionItem> &pool, T *protobuf, MissionItem *parent)
 {
     assert(protobuf);
-    auto *child = new MissionItem(
-        {QString::fromStdString(protobuf->GetDescriptor()->name()), QString::fromStdString(protobuf->name())}, protobuf,
-        parent);
-    parent->appendChild(child);
-    return child;
-}
-
-template <class T>
-inline MissionItem *appendRail(T *protobuf, MissionItem *parent)
-{
-    assert(protobuf);
-    auto *elder = appendItem(protobuf, parent);
-    appendItem(protobuf->mutable_p0(), elder);
-    appendItem(protobuf->mutable_p1(), elder);
+    return pool.create(protobuf, parent);
 }
 
-inline void appendElement(pb::mission::Mission::Element *element, MissionItem *parent)
+// Creates the item of the element only, the children of the element (the
+// points of a rail or a segment) are fetched later on. An element whose oneof
+// isn't set is valid protobuf, it gets a placeholder item of no component type
+// so that the items keep matching the rows of the protobuf messages.
+inline MissionItem *createElement(MissionPool<MissionItem> &pool, pb::mission::Mission::Element *element,
+                                  MissionItem *parent)
 {
-    MissionItem *elder;
     switch (element->element_case()) {
         case pb::mission::Mission::Element::kPoint:
-            appendItem(element->mutable_point(), parent);
-            break;
+            return createItem(pool, element->mutable_point(), parent);
         case pb::mission::Mission::Element::kRail:
-            elder = appendItem(element->mutable_rail(), parent);
-            appendItem(element->mutable_rail()->mutable_p0(), elder);
-            appendItem(element->mutable_rail()->mutable_p1(), elder);
-            break;
+            return createItem(pool, element->mutable_rail(), parent);
         case pb::mission::Mission::Element::kSegment:
-            elder = appendItem(element->mutable_segment(), parent);
-            appendItem(element->mutable_segment()->mutable_p0(), elder);
-            appendItem(element->mutable_segment()->mutable_p1(), elder);
-            break;
+            return createItem(pool, element->mutable_segment(), parent);
+        default:
+            return createItem(pool, element, parent);
+    }
+};
+
+// Creates the item of the component only, the children of the component (the
+// elements of a collection) are fetched later on. A component whose oneof isn't
+// set gets a placeholder item, as an element does.
+inline MissionItem *createComponent(MissionPool<MissionItem> &pool, pb::mission::Mission::Component *component,
+                                    MissionItem *parent)
+{
+    switch (component->component_case()) {
+        case pb::mission::Mission::Component::kElement:
+            return createElement(pool, component->mutable_element(), parent);
+        case pb::mission::Mission::Component::kCollection:
+            return createItem(pool, component->mutable_collection(), parent);
         default:
-            break;
+            return createItem(pool, component, parent);
     }
 };
 
-inline void appendCollection(pb::mission::Mission::Collection *collection, MissionItem *parent)
+// Creates the item of the protobuf child specified by the given row of the
+// parent item. The item isn't added to the children of the parent item.
+inline MissionItem *createChild(MissionPool<MissionItem> &pool, MissionItem *parent, int row)
 {
-    auto *elder = appendItem(collection, parent);
-    for (auto &element : *collection->mutable_elements()) {
-        appendElement(&element, elder);
+    auto *protobuf = parent->backend().protobuf();
+    switch (parent->backend().componentType()) {
+        case mission::kMission:
+            return createComponent(pool, static_cast<pb::mission::Mission *>(protobuf)->mutable_components(row),
+                                   parent);
+        case mission::kCollection: {
+            auto *collection = static_cast<pb::mission::Mission::Collection *>(protobuf);
+            return createElement(pool, collection->mutable_elements(row), parent);
+        }
+        case mission::kRail: {
+            auto *rail = static_cast<pb::mission::Mission::Element::Rail *>(protobuf);
+            return createItem(pool, row ? rail->mutable_p1() : rail->mutable_p0(), parent);
+        }
+        case mission::kSegment: {
+            auto *segment = static_cast<pb::mission::Mission::Element::Segment *>(protobuf);
+            return createItem(pool, row ? segment->mutable_p1() : segment->mutable_p0(), parent);
+        }
+        default:
+            return nullptr;
     }
 };
 
+// Appends the item of the protobuf child specified by the given row to the
+// parent item. The children are fetched in order, so the row must be the
+// number of children the parent item already holds.
+inline MissionItem *fetchChild(MissionPool<MissionItem> &pool, MissionItem *parent, int row)
+{
+    auto *child = createChild(pool, parent, row);
+    if (child) parent->appendChild(child);
+    return child;
+}
+
 } // namespace misc
 
 #endif // RTSYS_MISSION_MODEL_MISC_H
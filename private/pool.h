@@ -0,0 +1,134 @@
+#ifndef RTSYS_MISSION_POOL_H
+#define RTSYS_MISSION_POOL_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include <QVector>
+
+#include <new>
+#include <utility>
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines a pool of objects. The objects are allocated from slabs of
+// contiguous slots, so that neighbouring objects share cache lines and the
+// heap is hit once per slab and not once per object. A destroyed object gives
+// its slot back to a free list, the next created object reuses it first.
+// Resetting the pool makes every slot available again at once while keeping
+// the slabs, so that a reload doesn't allocate again. The pool never calls the
+// destructor of the objects still alive, their owner is responsible for it.
+template <class T>
+class MissionPool
+{
+  public:
+    explicit MissionPool(int slab_size = 1024);
+    ~MissionPool();
+
+    template <class... Args>
+    T *create(Args &&... args);
+    void destroy(T *object);
+    void reset();
+
+    int count() const { return _count; }
+    int slabCount() const { return _slabs.count(); }
+    qint64 allocationCount() const { return _allocations; }
+
+  private:
+    union Slot {
+        Slot *next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    Slot *allocate();
+
+    QVector<Slot *> _slabs;
+    int _slab_size;
+    int _slab;
+    int _next;
+    Slot *_free;
+    int _count;
+    qint64 _allocations;
+
+    MissionPool(const MissionPool &) = delete;
+    MissionPool &operator=(const MissionPool &) = delete;
+};
+
+template <class T>
+MissionPool<T>::MissionPool(int slab_size)
+    : _slab_size(slab_size)
+    , _slab(0)
+    , _next(0)
+    , _free(nullptr)
+    , _count(0)
+    , _allocations(0)
+{
+}
+
+template <class T>
+MissionPool<T>::~MissionPool()
+{
+    for (auto *slab : _slabs) {
+        delete[] slab;
+    }
+}
+
+// Returns a free slot. The free list is used first, then the next slot of the
+// current slab, then the following slab which is allocated when needed.
+template <class T>
+typename MissionPool<T>::Slot *MissionPool<T>::allocate()
+{
+    if (_free) {
+        auto *slot = _free;
+        _free = slot->next;
+        return slot;
+    }
+    if (_slab < _slabs.count() && _next == _slab_size) {
+        _slab++;
+        _next = 0;
+    }
+    if (_slab == _slabs.count()) {
+        _slabs.append(new Slot[_slab_size]);
+        _allocations++;
+    }
+    return &_slabs.at(_slab)[_next++];
+}
+
+// Creates an object from the given arguments into a free slot.
+template <class T>
+template <class... Args>
+T *MissionPool<T>::create(Args &&... args)
+{
+    auto *object = new (allocate()->storage) T(std::forward<Args>(args)...);
+    _count++;
+    return object;
+}
+
+// Destroys the given object and gives its slot back to the free list.
+template <class T>
+void MissionPool<T>::destroy(T *object)
+{
+    if (!object) return;
+
+    object->~T();
+    auto *slot = reinterpret_cast<Slot *>(object);
+    slot->next = _free;
+    _free = slot;
+    _count--;
+}
+
+// Makes every slot of every slab available again. This is constant time, the
+// objects must have been destroyed before.
+template <class T>
+void MissionPool<T>::reset()
+{
+    _slab = 0;
+    _next = 0;
+    _free = nullptr;
+    _count = 0;
+}
+
+#endif // RTSYS_MISSION_POOL_H
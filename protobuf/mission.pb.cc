@@ -5,481 +5,507 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace protobuf_mission_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_mission_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Mission_Element_Point;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_mission_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_Mission_Collection;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_mission_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_Mission_Element_Rail;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_mission_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_Mission_Element_Segment;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_mission_2eproto ::google::protobuf::internal::SCCInfo<2> scc_info_Mission_Component;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_mission_2eproto ::google::protobuf::internal::SCCInfo<3> scc_info_Mission_Element;
-}  // namespace protobuf_mission_2eproto
 namespace pb {
 namespace mission {
-class Mission_Element_PointDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Mission_Element_Point>
-      _instance;
-} _Mission_Element_Point_default_instance_;
-class Mission_Element_RailDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Mission_Element_Rail>
-      _instance;
-} _Mission_Element_Rail_default_instance_;
-class Mission_Element_SegmentDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Mission_Element_Segment>
-      _instance;
-} _Mission_Element_Segment_default_instance_;
-class Mission_ElementDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Mission_Element>
-      _instance;
-  const ::pb::mission::Mission_Element_Point* point_;
-  const ::pb::mission::Mission_Element_Rail* rail_;
-  const ::pb::mission::Mission_Element_Segment* segment_;
-} _Mission_Element_default_instance_;
-class Mission_CollectionDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Mission_Collection>
-      _instance;
-} _Mission_Collection_default_instance_;
-class Mission_ComponentDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Mission_Component>
-      _instance;
-  const ::pb::mission::Mission_Element* element_;
-  const ::pb::mission::Mission_Collection* collection_;
-} _Mission_Component_default_instance_;
-class MissionDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Mission>
-      _instance;
-} _Mission_default_instance_;
+PROTOBUF_CONSTEXPR Mission_Element_Point::Mission_Element_Point(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct Mission_Element_PointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Mission_Element_PointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Mission_Element_PointDefaultTypeInternal() {}
+  union {
+    Mission_Element_Point _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Mission_Element_PointDefaultTypeInternal _Mission_Element_Point_default_instance_;
+PROTOBUF_CONSTEXPR Mission_Element_Rail::Mission_Element_Rail(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.p0_)*/nullptr
+  , /*decltype(_impl_.p1_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct Mission_Element_RailDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Mission_Element_RailDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Mission_Element_RailDefaultTypeInternal() {}
+  union {
+    Mission_Element_Rail _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Mission_Element_RailDefaultTypeInternal _Mission_Element_Rail_default_instance_;
+PROTOBUF_CONSTEXPR Mission_Element_Segment::Mission_Element_Segment(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.p0_)*/nullptr
+  , /*decltype(_impl_.p1_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct Mission_Element_SegmentDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Mission_Element_SegmentDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Mission_Element_SegmentDefaultTypeInternal() {}
+  union {
+    Mission_Element_Segment _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Mission_Element_SegmentDefaultTypeInternal _Mission_Element_Segment_default_instance_;
+PROTOBUF_CONSTEXPR Mission_Element::Mission_Element(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.element_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct Mission_ElementDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Mission_ElementDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Mission_ElementDefaultTypeInternal() {}
+  union {
+    Mission_Element _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Mission_ElementDefaultTypeInternal _Mission_Element_default_instance_;
+PROTOBUF_CONSTEXPR Mission_Collection::Mission_Collection(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.elements_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct Mission_CollectionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Mission_CollectionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Mission_CollectionDefaultTypeInternal() {}
+  union {
+    Mission_Collection _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Mission_CollectionDefaultTypeInternal _Mission_Collection_default_instance_;
+PROTOBUF_CONSTEXPR Mission_Component::Mission_Component(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.component_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct Mission_ComponentDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Mission_ComponentDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Mission_ComponentDefaultTypeInternal() {}
+  union {
+    Mission_Component _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Mission_ComponentDefaultTypeInternal _Mission_Component_default_instance_;
+PROTOBUF_CONSTEXPR Mission::Mission(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.components_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MissionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MissionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MissionDefaultTypeInternal() {}
+  union {
+    Mission _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MissionDefaultTypeInternal _Mission_default_instance_;
+PROTOBUF_CONSTEXPR MissionIndex_Component::MissionIndex_Component(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.element_offsets_)*/{}
+  , /*decltype(_impl_._element_offsets_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.element_sizes_)*/{}
+  , /*decltype(_impl_._element_sizes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MissionIndex_ComponentDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MissionIndex_ComponentDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MissionIndex_ComponentDefaultTypeInternal() {}
+  union {
+    MissionIndex_Component _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MissionIndex_ComponentDefaultTypeInternal _MissionIndex_Component_default_instance_;
+PROTOBUF_CONSTEXPR MissionIndex::MissionIndex(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.components_)*/{}
+  , /*decltype(_impl_.header_offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.header_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MissionIndexDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MissionIndexDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MissionIndexDefaultTypeInternal() {}
+  union {
+    MissionIndex _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MissionIndexDefaultTypeInternal _MissionIndex_default_instance_;
+PROTOBUF_CONSTEXPR MissionEdit::MissionEdit(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.parent_)*/{}
+  , /*decltype(_impl_._parent_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.row_)*/0u
+  , /*decltype(_impl_.count_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MissionEditDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MissionEditDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MissionEditDefaultTypeInternal() {}
+  union {
+    MissionEdit _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MissionEditDefaultTypeInternal _MissionEdit_default_instance_;
 }  // namespace mission
 }  // namespace pb
-namespace protobuf_mission_2eproto {
-static void InitDefaultsMission_Element_Point() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::pb::mission::_Mission_Element_Point_default_instance_;
-    new (ptr) ::pb::mission::Mission_Element_Point();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::pb::mission::Mission_Element_Point::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_Mission_Element_Point =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsMission_Element_Point}, {}};
-
-static void InitDefaultsMission_Element_Rail() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::pb::mission::_Mission_Element_Rail_default_instance_;
-    new (ptr) ::pb::mission::Mission_Element_Rail();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::pb::mission::Mission_Element_Rail::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_Mission_Element_Rail =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsMission_Element_Rail}, {
-      &protobuf_mission_2eproto::scc_info_Mission_Element_Point.base,}};
-
-static void InitDefaultsMission_Element_Segment() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::pb::mission::_Mission_Element_Segment_default_instance_;
-    new (ptr) ::pb::mission::Mission_Element_Segment();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::pb::mission::Mission_Element_Segment::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_Mission_Element_Segment =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsMission_Element_Segment}, {
-      &protobuf_mission_2eproto::scc_info_Mission_Element_Point.base,}};
-
-static void InitDefaultsMission_Element() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::pb::mission::_Mission_Element_default_instance_;
-    new (ptr) ::pb::mission::Mission_Element();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::pb::mission::Mission_Element::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<3> scc_info_Mission_Element =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 3, InitDefaultsMission_Element}, {
-      &protobuf_mission_2eproto::scc_info_Mission_Element_Point.base,
-      &protobuf_mission_2eproto::scc_info_Mission_Element_Rail.base,
-      &protobuf_mission_2eproto::scc_info_Mission_Element_Segment.base,}};
-
-static void InitDefaultsMission_Collection() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::pb::mission::_Mission_Collection_default_instance_;
-    new (ptr) ::pb::mission::Mission_Collection();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::pb::mission::Mission_Collection::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_Mission_Collection =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsMission_Collection}, {
-      &protobuf_mission_2eproto::scc_info_Mission_Element.base,}};
-
-static void InitDefaultsMission_Component() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::pb::mission::_Mission_Component_default_instance_;
-    new (ptr) ::pb::mission::Mission_Component();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::pb::mission::Mission_Component::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_Mission_Component =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsMission_Component}, {
-      &protobuf_mission_2eproto::scc_info_Mission_Element.base,
-      &protobuf_mission_2eproto::scc_info_Mission_Collection.base,}};
+static ::_pb::Metadata file_level_metadata_mission_2eproto[10];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_mission_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_mission_2eproto = nullptr;
 
-static void InitDefaultsMission() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::pb::mission::_Mission_default_instance_;
-    new (ptr) ::pb::mission::Mission();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::pb::mission::Mission::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_Mission =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsMission}, {
-      &protobuf_mission_2eproto::scc_info_Mission_Component.base,}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_Mission_Element_Point.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Mission_Element_Rail.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Mission_Element_Segment.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Mission_Element.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Mission_Collection.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Mission_Component.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Mission.base);
-}
-
-::google::protobuf::Metadata file_level_metadata[7];
-
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_mission_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element_Point, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element_Point, _impl_.name_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element_Point, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element_Rail, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element_Point, name_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element_Rail, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element_Rail, _impl_.p0_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element_Rail, _impl_.p1_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element_Rail, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element_Segment, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element_Rail, name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element_Rail, p0_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element_Rail, p1_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element_Segment, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element_Segment, _impl_.p0_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element_Segment, _impl_.p1_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Element, _impl_.element_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element_Segment, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Collection, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element_Segment, name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element_Segment, p0_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element_Segment, p1_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Collection, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Collection, _impl_.elements_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Component, _internal_metadata_),
   ~0u,  // no _extensions_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Component, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  offsetof(::pb::mission::Mission_ElementDefaultTypeInternal, point_),
-  offsetof(::pb::mission::Mission_ElementDefaultTypeInternal, rail_),
-  offsetof(::pb::mission::Mission_ElementDefaultTypeInternal, segment_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Element, element_),
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission_Component, _impl_.component_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Collection, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Collection, name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Collection, elements_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::Mission, _impl_.components_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Component, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionIndex_Component, _internal_metadata_),
   ~0u,  // no _extensions_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Component, _oneof_case_[0]),
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionIndex_Component, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionIndex_Component, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionIndex_Component, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionIndex_Component, _impl_.element_offsets_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionIndex_Component, _impl_.element_sizes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionIndex, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  offsetof(::pb::mission::Mission_ComponentDefaultTypeInternal, element_),
-  offsetof(::pb::mission::Mission_ComponentDefaultTypeInternal, collection_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission_Component, component_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionIndex, _impl_.components_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionIndex, _impl_.header_offset_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionIndex, _impl_.header_size_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionEdit, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission, name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::pb::mission::Mission, components_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionEdit, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionEdit, _impl_.parent_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionEdit, _impl_.row_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionEdit, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionEdit, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::pb::mission::MissionEdit, _impl_.messages_),
 };
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::pb::mission::Mission_Element_Point)},
-  { 6, -1, sizeof(::pb::mission::Mission_Element_Rail)},
-  { 14, -1, sizeof(::pb::mission::Mission_Element_Segment)},
-  { 22, -1, sizeof(::pb::mission::Mission_Element)},
-  { 31, -1, sizeof(::pb::mission::Mission_Collection)},
-  { 38, -1, sizeof(::pb::mission::Mission_Component)},
-  { 46, -1, sizeof(::pb::mission::Mission)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::pb::mission::Mission_Element_Point)},
+  { 7, -1, -1, sizeof(::pb::mission::Mission_Element_Rail)},
+  { 16, -1, -1, sizeof(::pb::mission::Mission_Element_Segment)},
+  { 25, -1, -1, sizeof(::pb::mission::Mission_Element)},
+  { 35, -1, -1, sizeof(::pb::mission::Mission_Collection)},
+  { 43, -1, -1, sizeof(::pb::mission::Mission_Component)},
+  { 52, -1, -1, sizeof(::pb::mission::Mission)},
+  { 60, -1, -1, sizeof(::pb::mission::MissionIndex_Component)},
+  { 71, -1, -1, sizeof(::pb::mission::MissionIndex)},
+  { 80, -1, -1, sizeof(::pb::mission::MissionEdit)},
 };
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::pb::mission::_Mission_Element_Point_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::pb::mission::_Mission_Element_Rail_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::pb::mission::_Mission_Element_Segment_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::pb::mission::_Mission_Element_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::pb::mission::_Mission_Collection_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::pb::mission::_Mission_Component_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::pb::mission::_Mission_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::pb::mission::_Mission_Element_Point_default_instance_._instance,
+  &::pb::mission::_Mission_Element_Rail_default_instance_._instance,
+  &::pb::mission::_Mission_Element_Segment_default_instance_._instance,
+  &::pb::mission::_Mission_Element_default_instance_._instance,
+  &::pb::mission::_Mission_Collection_default_instance_._instance,
+  &::pb::mission::_Mission_Component_default_instance_._instance,
+  &::pb::mission::_Mission_default_instance_._instance,
+  &::pb::mission::_MissionIndex_Component_default_instance_._instance,
+  &::pb::mission::_MissionIndex_default_instance_._instance,
+  &::pb::mission::_MissionEdit_default_instance_._instance,
 };
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  AssignDescriptors(
-      "mission.proto", schemas, file_default_instances, TableStruct::offsets,
-      file_level_metadata, NULL, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, protobuf_AssignDescriptors);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 7);
-}
-
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\rmission.proto\022\npb.mission\"\314\005\n\007Mission\022"
-      "\014\n\004name\030\001 \001(\t\0221\n\ncomponents\030\002 \003(\0132\035.pb.m"
-      "ission.Mission.Component\032\264\003\n\007Element\0222\n\005"
-      "point\030\001 \001(\0132!.pb.mission.Mission.Element"
-      ".PointH\000\0220\n\004rail\030\002 \001(\0132 .pb.mission.Miss"
-      "ion.Element.RailH\000\0226\n\007segment\030\003 \001(\0132#.pb"
-      ".mission.Mission.Element.SegmentH\000\032\025\n\005Po"
-      "int\022\014\n\004name\030\001 \001(\t\032r\n\004Rail\022\014\n\004name\030\001 \001(\t\022"
-      "-\n\002p0\030\002 \001(\0132!.pb.mission.Mission.Element"
-      ".Point\022-\n\002p1\030\003 \001(\0132!.pb.mission.Mission."
-      "Element.Point\032u\n\007Segment\022\014\n\004name\030\001 \001(\t\022-"
-      "\n\002p0\030\002 \001(\0132!.pb.mission.Mission.Element."
-      "Point\022-\n\002p1\030\003 \001(\0132!.pb.mission.Mission.E"
-      "lement.PointB\t\n\007element\032I\n\nCollection\022\014\n"
-      "\004name\030\001 \001(\t\022-\n\010elements\030\002 \003(\0132\033.pb.missi"
-      "on.Mission.Element\032~\n\tComponent\022.\n\007eleme"
-      "nt\030\001 \001(\0132\033.pb.mission.Mission.ElementH\000\022"
-      "4\n\ncollection\030\002 \001(\0132\036.pb.mission.Mission"
-      ".CollectionH\000B\013\n\tcomponentb\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 754);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "mission.proto", &protobuf_RegisterTypes);
+const char descriptor_table_protodef_mission_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rmission.proto\022\npb.mission\"\314\005\n\007Mission\022"
+  "\014\n\004name\030\001 \001(\t\0221\n\ncomponents\030\002 \003(\0132\035.pb.m"
+  "ission.Mission.Component\032\264\003\n\007Element\0222\n\005"
+  "point\030\001 \001(\0132!.pb.mission.Mission.Element"
+  ".PointH\000\0220\n\004rail\030\002 \001(\0132 .pb.mission.Miss"
+  "ion.Element.RailH\000\0226\n\007segment\030\003 \001(\0132#.pb"
+  ".mission.Mission.Element.SegmentH\000\032\025\n\005Po"
+  "int\022\014\n\004name\030\001 \001(\t\032r\n\004Rail\022\014\n\004name\030\001 \001(\t\022"
+  "-\n\002p0\030\002 \001(\0132!.pb.mission.Mission.Element"
+  ".Point\022-\n\002p1\030\003 \001(\0132!.pb.mission.Mission."
+  "Element.Point\032u\n\007Segment\022\014\n\004name\030\001 \001(\t\022-"
+  "\n\002p0\030\002 \001(\0132!.pb.mission.Mission.Element."
+  "Point\022-\n\002p1\030\003 \001(\0132!.pb.mission.Mission.E"
+  "lement.PointB\t\n\007element\032I\n\nCollection\022\014\n"
+  "\004name\030\001 \001(\t\022-\n\010elements\030\002 \003(\0132\033.pb.missi"
+  "on.Mission.Element\032~\n\tComponent\022.\n\007eleme"
+  "nt\030\001 \001(\0132\033.pb.mission.Mission.ElementH\000\022"
+  "4\n\ncollection\030\002 \001(\0132\036.pb.mission.Mission"
+  ".CollectionH\000B\013\n\tcomponent\"\333\001\n\014MissionIn"
+  "dex\0226\n\ncomponents\030\001 \003(\0132\".pb.mission.Mis"
+  "sionIndex.Component\022\025\n\rheader_offset\030\002 \001"
+  "(\004\022\023\n\013header_size\030\003 \001(\r\032g\n\tComponent\022\016\n\006"
+  "offset\030\001 \001(\004\022\014\n\004size\030\002 \001(\r\022\014\n\004name\030\003 \001(\t"
+  "\022\027\n\017element_offsets\030\004 \003(\004\022\025\n\relement_siz"
+  "es\030\005 \003(\r\"\304\001\n\013MissionEdit\022*\n\004type\030\001 \001(\0162\034"
+  ".pb.mission.MissionEdit.Type\022\016\n\006parent\030\002"
+  " \003(\r\022\013\n\003row\030\003 \001(\r\022\r\n\005count\030\004 \001(\r\022\014\n\004name"
+  "\030\005 \001(\t\022\020\n\010messages\030\006 \003(\014\"=\n\004Type\022\r\n\tkAdd"
+  "Point\020\000\022\014\n\010kAddRail\020\001\022\013\n\007kRemove\020\002\022\013\n\007kI"
+  "nsert\020\003B\003\370\001\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_mission_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_mission_2eproto = {
+    false, false, 1180, descriptor_table_protodef_mission_2eproto,
+    "mission.proto",
+    &descriptor_table_mission_2eproto_once, nullptr, 0, 10,
+    schemas, file_default_instances, TableStruct_mission_2eproto::offsets,
+    file_level_metadata_mission_2eproto, file_level_enum_descriptors_mission_2eproto,
+    file_level_service_descriptors_mission_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_mission_2eproto_getter() {
+  return &descriptor_table_mission_2eproto;
 }
 
-void AddDescriptors() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, AddDescriptorsImpl);
-}
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
-  }
-} static_descriptor_initializer;
-}  // namespace protobuf_mission_2eproto
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_mission_2eproto(&descriptor_table_mission_2eproto);
 namespace pb {
 namespace mission {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MissionEdit_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_mission_2eproto);
+  return file_level_enum_descriptors_mission_2eproto[0];
+}
+bool MissionEdit_Type_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr MissionEdit_Type MissionEdit::kAddPoint;
+constexpr MissionEdit_Type MissionEdit::kAddRail;
+constexpr MissionEdit_Type MissionEdit::kRemove;
+constexpr MissionEdit_Type MissionEdit::kInsert;
+constexpr MissionEdit_Type MissionEdit::Type_MIN;
+constexpr MissionEdit_Type MissionEdit::Type_MAX;
+constexpr int MissionEdit::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
-void Mission_Element_Point::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Mission_Element_Point::kNameFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Mission_Element_Point::_Internal {
+ public:
+};
 
-Mission_Element_Point::Mission_Element_Point()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_mission_2eproto::scc_info_Mission_Element_Point.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:pb.mission.Mission.Element.Point)
+Mission_Element_Point::Mission_Element_Point(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pb.mission.Mission.Element.Point)
 }
 Mission_Element_Point::Mission_Element_Point(const Mission_Element_Point& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Mission_Element_Point* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:pb.mission.Mission.Element.Point)
 }
 
-void Mission_Element_Point::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Mission_Element_Point::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Mission_Element_Point::~Mission_Element_Point() {
   // @@protoc_insertion_point(destructor:pb.mission.Mission.Element.Point)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Mission_Element_Point::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Mission_Element_Point::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
 void Mission_Element_Point::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* Mission_Element_Point::descriptor() {
-  ::protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Mission_Element_Point& Mission_Element_Point::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_mission_2eproto::scc_info_Mission_Element_Point.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Mission_Element_Point::Clear() {
 // @@protoc_insertion_point(message_clear_start:pb.mission.Mission.Element.Point)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Mission_Element_Point::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:pb.mission.Mission.Element.Point)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Mission_Element_Point::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "pb.mission.Mission.Element.Point.name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pb.mission.Mission.Element.Point.name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:pb.mission.Mission.Element.Point)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:pb.mission.Mission.Element.Point)
-  return false;
-#undef DO_
-}
-
-void Mission_Element_Point::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:pb.mission.Mission.Element.Point)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "pb.mission.Mission.Element.Point.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:pb.mission.Mission.Element.Point)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Mission_Element_Point::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* Mission_Element_Point::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:pb.mission.Mission.Element.Point)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "pb.mission.Mission.Element.Point.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:pb.mission.Mission.Element.Point)
   return target;
@@ -489,56 +515,39 @@ size_t Mission_Element_Point::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:pb.mission.Mission.Element.Point)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Mission_Element_Point::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:pb.mission.Mission.Element.Point)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Mission_Element_Point* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Mission_Element_Point>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:pb.mission.Mission.Element.Point)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:pb.mission.Mission.Element.Point)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Mission_Element_Point::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Mission_Element_Point::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Mission_Element_Point::GetClassData() const { return &_class_data_; }
 
-void Mission_Element_Point::MergeFrom(const Mission_Element_Point& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Element.Point)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
+void Mission_Element_Point::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Mission_Element_Point*>(&to_msg);
+  auto& from = static_cast<const Mission_Element_Point&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Element.Point)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-}
-
-void Mission_Element_Point::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:pb.mission.Mission.Element.Point)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Mission_Element_Point::CopyFrom(const Mission_Element_Point& from) {
@@ -552,255 +561,214 @@ bool Mission_Element_Point::IsInitialized() const {
   return true;
 }
 
-void Mission_Element_Point::Swap(Mission_Element_Point* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Mission_Element_Point::InternalSwap(Mission_Element_Point* other) {
   using std::swap;
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata Mission_Element_Point::GetMetadata() const {
-  protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Mission_Element_Point::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mission_2eproto_getter, &descriptor_table_mission_2eproto_once,
+      file_level_metadata_mission_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void Mission_Element_Rail::InitAsDefaultInstance() {
-  ::pb::mission::_Mission_Element_Rail_default_instance_._instance.get_mutable()->p0_ = const_cast< ::pb::mission::Mission_Element_Point*>(
-      ::pb::mission::Mission_Element_Point::internal_default_instance());
-  ::pb::mission::_Mission_Element_Rail_default_instance_._instance.get_mutable()->p1_ = const_cast< ::pb::mission::Mission_Element_Point*>(
-      ::pb::mission::Mission_Element_Point::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Mission_Element_Rail::kNameFieldNumber;
-const int Mission_Element_Rail::kP0FieldNumber;
-const int Mission_Element_Rail::kP1FieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Mission_Element_Rail::Mission_Element_Rail()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_mission_2eproto::scc_info_Mission_Element_Rail.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:pb.mission.Mission.Element.Rail)
+class Mission_Element_Rail::_Internal {
+ public:
+  static const ::pb::mission::Mission_Element_Point& p0(const Mission_Element_Rail* msg);
+  static const ::pb::mission::Mission_Element_Point& p1(const Mission_Element_Rail* msg);
+};
+
+const ::pb::mission::Mission_Element_Point&
+Mission_Element_Rail::_Internal::p0(const Mission_Element_Rail* msg) {
+  return *msg->_impl_.p0_;
+}
+const ::pb::mission::Mission_Element_Point&
+Mission_Element_Rail::_Internal::p1(const Mission_Element_Rail* msg) {
+  return *msg->_impl_.p1_;
+}
+Mission_Element_Rail::Mission_Element_Rail(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pb.mission.Mission.Element.Rail)
 }
 Mission_Element_Rail::Mission_Element_Rail(const Mission_Element_Rail& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  if (from.has_p0()) {
-    p0_ = new ::pb::mission::Mission_Element_Point(*from.p0_);
-  } else {
-    p0_ = NULL;
-  }
-  if (from.has_p1()) {
-    p1_ = new ::pb::mission::Mission_Element_Point(*from.p1_);
-  } else {
-    p1_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Mission_Element_Rail* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.p0_){nullptr}
+    , decltype(_impl_.p1_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_p0()) {
+    _this->_impl_.p0_ = new ::pb::mission::Mission_Element_Point(*from._impl_.p0_);
+  }
+  if (from._internal_has_p1()) {
+    _this->_impl_.p1_ = new ::pb::mission::Mission_Element_Point(*from._impl_.p1_);
   }
   // @@protoc_insertion_point(copy_constructor:pb.mission.Mission.Element.Rail)
 }
 
-void Mission_Element_Rail::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&p0_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&p1_) -
-      reinterpret_cast<char*>(&p0_)) + sizeof(p1_));
+inline void Mission_Element_Rail::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.p0_){nullptr}
+    , decltype(_impl_.p1_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Mission_Element_Rail::~Mission_Element_Rail() {
   // @@protoc_insertion_point(destructor:pb.mission.Mission.Element.Rail)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Mission_Element_Rail::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete p0_;
-  if (this != internal_default_instance()) delete p1_;
+inline void Mission_Element_Rail::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.p0_;
+  if (this != internal_default_instance()) delete _impl_.p1_;
 }
 
 void Mission_Element_Rail::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* Mission_Element_Rail::descriptor() {
-  ::protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Mission_Element_Rail& Mission_Element_Rail::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_mission_2eproto::scc_info_Mission_Element_Rail.base);
-  return *internal_default_instance();
-}
-
 
 void Mission_Element_Rail::Clear() {
 // @@protoc_insertion_point(message_clear_start:pb.mission.Mission.Element.Rail)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && p0_ != NULL) {
-    delete p0_;
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.p0_ != nullptr) {
+    delete _impl_.p0_;
   }
-  p0_ = NULL;
-  if (GetArenaNoVirtual() == NULL && p1_ != NULL) {
-    delete p1_;
+  _impl_.p0_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.p1_ != nullptr) {
+    delete _impl_.p1_;
   }
-  p1_ = NULL;
-  _internal_metadata_.Clear();
+  _impl_.p1_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Mission_Element_Rail::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:pb.mission.Mission.Element.Rail)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Mission_Element_Rail::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "pb.mission.Mission.Element.Rail.name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pb.mission.Mission.Element.Rail.name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .pb.mission.Mission.Element.Point p0 = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_p0()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_p0(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .pb.mission.Mission.Element.Point p1 = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_p1()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_p1(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:pb.mission.Mission.Element.Rail)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:pb.mission.Mission.Element.Rail)
-  return false;
-#undef DO_
-}
-
-void Mission_Element_Rail::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:pb.mission.Mission.Element.Rail)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "pb.mission.Mission.Element.Rail.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // .pb.mission.Mission.Element.Point p0 = 2;
-  if (this->has_p0()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_p0(), output);
-  }
-
-  // .pb.mission.Mission.Element.Point p1 = 3;
-  if (this->has_p1()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->_internal_p1(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:pb.mission.Mission.Element.Rail)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Mission_Element_Rail::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* Mission_Element_Rail::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:pb.mission.Mission.Element.Rail)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "pb.mission.Mission.Element.Rail.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // .pb.mission.Mission.Element.Point p0 = 2;
-  if (this->has_p0()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_p0(), deterministic, target);
+  if (this->_internal_has_p0()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::p0(this),
+        _Internal::p0(this).GetCachedSize(), target, stream);
   }
 
   // .pb.mission.Mission.Element.Point p1 = 3;
-  if (this->has_p1()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->_internal_p1(), deterministic, target);
+  if (this->_internal_has_p1()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::p1(this),
+        _Internal::p1(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:pb.mission.Mission.Element.Rail)
   return target;
@@ -810,76 +778,61 @@ size_t Mission_Element_Rail::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:pb.mission.Mission.Element.Rail)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   // .pb.mission.Mission.Element.Point p0 = 2;
-  if (this->has_p0()) {
+  if (this->_internal_has_p0()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *p0_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.p0_);
   }
 
   // .pb.mission.Mission.Element.Point p1 = 3;
-  if (this->has_p1()) {
+  if (this->_internal_has_p1()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *p1_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.p1_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Mission_Element_Rail::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:pb.mission.Mission.Element.Rail)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Mission_Element_Rail* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Mission_Element_Rail>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:pb.mission.Mission.Element.Rail)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:pb.mission.Mission.Element.Rail)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Mission_Element_Rail::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Mission_Element_Rail::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Mission_Element_Rail::GetClassData() const { return &_class_data_; }
 
-void Mission_Element_Rail::MergeFrom(const Mission_Element_Rail& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Element.Rail)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
+void Mission_Element_Rail::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Mission_Element_Rail*>(&to_msg);
+  auto& from = static_cast<const Mission_Element_Rail&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Element.Rail)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.has_p0()) {
-    mutable_p0()->::pb::mission::Mission_Element_Point::MergeFrom(from.p0());
+  if (from._internal_has_p0()) {
+    _this->_internal_mutable_p0()->::pb::mission::Mission_Element_Point::MergeFrom(
+        from._internal_p0());
   }
-  if (from.has_p1()) {
-    mutable_p1()->::pb::mission::Mission_Element_Point::MergeFrom(from.p1());
+  if (from._internal_has_p1()) {
+    _this->_internal_mutable_p1()->::pb::mission::Mission_Element_Point::MergeFrom(
+        from._internal_p1());
   }
-}
-
-void Mission_Element_Rail::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:pb.mission.Mission.Element.Rail)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Mission_Element_Rail::CopyFrom(const Mission_Element_Rail& from) {
@@ -893,257 +846,220 @@ bool Mission_Element_Rail::IsInitialized() const {
   return true;
 }
 
-void Mission_Element_Rail::Swap(Mission_Element_Rail* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Mission_Element_Rail::InternalSwap(Mission_Element_Rail* other) {
   using std::swap;
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(p0_, other->p0_);
-  swap(p1_, other->p1_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Mission_Element_Rail, _impl_.p1_)
+      + sizeof(Mission_Element_Rail::_impl_.p1_)
+      - PROTOBUF_FIELD_OFFSET(Mission_Element_Rail, _impl_.p0_)>(
+          reinterpret_cast<char*>(&_impl_.p0_),
+          reinterpret_cast<char*>(&other->_impl_.p0_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Mission_Element_Rail::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mission_2eproto_getter, &descriptor_table_mission_2eproto_once,
+      file_level_metadata_mission_2eproto[1]);
 }
 
-::google::protobuf::Metadata Mission_Element_Rail::GetMetadata() const {
-  protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
 // ===================================================================
 
-void Mission_Element_Segment::InitAsDefaultInstance() {
-  ::pb::mission::_Mission_Element_Segment_default_instance_._instance.get_mutable()->p0_ = const_cast< ::pb::mission::Mission_Element_Point*>(
-      ::pb::mission::Mission_Element_Point::internal_default_instance());
-  ::pb::mission::_Mission_Element_Segment_default_instance_._instance.get_mutable()->p1_ = const_cast< ::pb::mission::Mission_Element_Point*>(
-      ::pb::mission::Mission_Element_Point::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Mission_Element_Segment::kNameFieldNumber;
-const int Mission_Element_Segment::kP0FieldNumber;
-const int Mission_Element_Segment::kP1FieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Mission_Element_Segment::Mission_Element_Segment()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_mission_2eproto::scc_info_Mission_Element_Segment.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:pb.mission.Mission.Element.Segment)
+class Mission_Element_Segment::_Internal {
+ public:
+  static const ::pb::mission::Mission_Element_Point& p0(const Mission_Element_Segment* msg);
+  static const ::pb::mission::Mission_Element_Point& p1(const Mission_Element_Segment* msg);
+};
+
+const ::pb::mission::Mission_Element_Point&
+Mission_Element_Segment::_Internal::p0(const Mission_Element_Segment* msg) {
+  return *msg->_impl_.p0_;
+}
+const ::pb::mission::Mission_Element_Point&
+Mission_Element_Segment::_Internal::p1(const Mission_Element_Segment* msg) {
+  return *msg->_impl_.p1_;
+}
+Mission_Element_Segment::Mission_Element_Segment(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pb.mission.Mission.Element.Segment)
 }
 Mission_Element_Segment::Mission_Element_Segment(const Mission_Element_Segment& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  if (from.has_p0()) {
-    p0_ = new ::pb::mission::Mission_Element_Point(*from.p0_);
-  } else {
-    p0_ = NULL;
-  }
-  if (from.has_p1()) {
-    p1_ = new ::pb::mission::Mission_Element_Point(*from.p1_);
-  } else {
-    p1_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Mission_Element_Segment* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.p0_){nullptr}
+    , decltype(_impl_.p1_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_p0()) {
+    _this->_impl_.p0_ = new ::pb::mission::Mission_Element_Point(*from._impl_.p0_);
+  }
+  if (from._internal_has_p1()) {
+    _this->_impl_.p1_ = new ::pb::mission::Mission_Element_Point(*from._impl_.p1_);
   }
   // @@protoc_insertion_point(copy_constructor:pb.mission.Mission.Element.Segment)
 }
 
-void Mission_Element_Segment::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&p0_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&p1_) -
-      reinterpret_cast<char*>(&p0_)) + sizeof(p1_));
+inline void Mission_Element_Segment::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.p0_){nullptr}
+    , decltype(_impl_.p1_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Mission_Element_Segment::~Mission_Element_Segment() {
   // @@protoc_insertion_point(destructor:pb.mission.Mission.Element.Segment)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Mission_Element_Segment::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete p0_;
-  if (this != internal_default_instance()) delete p1_;
+inline void Mission_Element_Segment::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.p0_;
+  if (this != internal_default_instance()) delete _impl_.p1_;
 }
 
 void Mission_Element_Segment::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* Mission_Element_Segment::descriptor() {
-  ::protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Mission_Element_Segment& Mission_Element_Segment::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_mission_2eproto::scc_info_Mission_Element_Segment.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Mission_Element_Segment::Clear() {
 // @@protoc_insertion_point(message_clear_start:pb.mission.Mission.Element.Segment)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && p0_ != NULL) {
-    delete p0_;
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.p0_ != nullptr) {
+    delete _impl_.p0_;
   }
-  p0_ = NULL;
-  if (GetArenaNoVirtual() == NULL && p1_ != NULL) {
-    delete p1_;
+  _impl_.p0_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.p1_ != nullptr) {
+    delete _impl_.p1_;
   }
-  p1_ = NULL;
-  _internal_metadata_.Clear();
+  _impl_.p1_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Mission_Element_Segment::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:pb.mission.Mission.Element.Segment)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Mission_Element_Segment::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "pb.mission.Mission.Element.Segment.name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pb.mission.Mission.Element.Segment.name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .pb.mission.Mission.Element.Point p0 = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_p0()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_p0(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .pb.mission.Mission.Element.Point p1 = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_p1()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_p1(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:pb.mission.Mission.Element.Segment)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:pb.mission.Mission.Element.Segment)
-  return false;
-#undef DO_
-}
-
-void Mission_Element_Segment::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:pb.mission.Mission.Element.Segment)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "pb.mission.Mission.Element.Segment.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // .pb.mission.Mission.Element.Point p0 = 2;
-  if (this->has_p0()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_p0(), output);
-  }
-
-  // .pb.mission.Mission.Element.Point p1 = 3;
-  if (this->has_p1()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->_internal_p1(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:pb.mission.Mission.Element.Segment)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Mission_Element_Segment::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* Mission_Element_Segment::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:pb.mission.Mission.Element.Segment)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "pb.mission.Mission.Element.Segment.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // .pb.mission.Mission.Element.Point p0 = 2;
-  if (this->has_p0()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_p0(), deterministic, target);
+  if (this->_internal_has_p0()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::p0(this),
+        _Internal::p0(this).GetCachedSize(), target, stream);
   }
 
   // .pb.mission.Mission.Element.Point p1 = 3;
-  if (this->has_p1()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->_internal_p1(), deterministic, target);
+  if (this->_internal_has_p1()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::p1(this),
+        _Internal::p1(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:pb.mission.Mission.Element.Segment)
   return target;
@@ -1153,76 +1069,61 @@ size_t Mission_Element_Segment::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:pb.mission.Mission.Element.Segment)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   // .pb.mission.Mission.Element.Point p0 = 2;
-  if (this->has_p0()) {
+  if (this->_internal_has_p0()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *p0_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.p0_);
   }
 
   // .pb.mission.Mission.Element.Point p1 = 3;
-  if (this->has_p1()) {
+  if (this->_internal_has_p1()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *p1_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.p1_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Mission_Element_Segment::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:pb.mission.Mission.Element.Segment)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Mission_Element_Segment* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Mission_Element_Segment>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:pb.mission.Mission.Element.Segment)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:pb.mission.Mission.Element.Segment)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Mission_Element_Segment::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Mission_Element_Segment::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Mission_Element_Segment::GetClassData() const { return &_class_data_; }
 
-void Mission_Element_Segment::MergeFrom(const Mission_Element_Segment& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Element.Segment)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
+void Mission_Element_Segment::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Mission_Element_Segment*>(&to_msg);
+  auto& from = static_cast<const Mission_Element_Segment&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Element.Segment)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.has_p0()) {
-    mutable_p0()->::pb::mission::Mission_Element_Point::MergeFrom(from.p0());
+  if (from._internal_has_p0()) {
+    _this->_internal_mutable_p0()->::pb::mission::Mission_Element_Point::MergeFrom(
+        from._internal_p0());
   }
-  if (from.has_p1()) {
-    mutable_p1()->::pb::mission::Mission_Element_Point::MergeFrom(from.p1());
+  if (from._internal_has_p1()) {
+    _this->_internal_mutable_p1()->::pb::mission::Mission_Element_Point::MergeFrom(
+        from._internal_p1());
   }
-}
-
-void Mission_Element_Segment::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:pb.mission.Mission.Element.Segment)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Mission_Element_Segment::CopyFrom(const Mission_Element_Segment& from) {
@@ -1236,106 +1137,125 @@ bool Mission_Element_Segment::IsInitialized() const {
   return true;
 }
 
-void Mission_Element_Segment::Swap(Mission_Element_Segment* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Mission_Element_Segment::InternalSwap(Mission_Element_Segment* other) {
   using std::swap;
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(p0_, other->p0_);
-  swap(p1_, other->p1_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata Mission_Element_Segment::GetMetadata() const {
-  protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Mission_Element_Segment, _impl_.p1_)
+      + sizeof(Mission_Element_Segment::_impl_.p1_)
+      - PROTOBUF_FIELD_OFFSET(Mission_Element_Segment, _impl_.p0_)>(
+          reinterpret_cast<char*>(&_impl_.p0_),
+          reinterpret_cast<char*>(&other->_impl_.p0_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Mission_Element_Segment::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mission_2eproto_getter, &descriptor_table_mission_2eproto_once,
+      file_level_metadata_mission_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void Mission_Element::InitAsDefaultInstance() {
-  ::pb::mission::_Mission_Element_default_instance_.point_ = const_cast< ::pb::mission::Mission_Element_Point*>(
-      ::pb::mission::Mission_Element_Point::internal_default_instance());
-  ::pb::mission::_Mission_Element_default_instance_.rail_ = const_cast< ::pb::mission::Mission_Element_Rail*>(
-      ::pb::mission::Mission_Element_Rail::internal_default_instance());
-  ::pb::mission::_Mission_Element_default_instance_.segment_ = const_cast< ::pb::mission::Mission_Element_Segment*>(
-      ::pb::mission::Mission_Element_Segment::internal_default_instance());
+class Mission_Element::_Internal {
+ public:
+  static const ::pb::mission::Mission_Element_Point& point(const Mission_Element* msg);
+  static const ::pb::mission::Mission_Element_Rail& rail(const Mission_Element* msg);
+  static const ::pb::mission::Mission_Element_Segment& segment(const Mission_Element* msg);
+};
+
+const ::pb::mission::Mission_Element_Point&
+Mission_Element::_Internal::point(const Mission_Element* msg) {
+  return *msg->_impl_.element_.point_;
+}
+const ::pb::mission::Mission_Element_Rail&
+Mission_Element::_Internal::rail(const Mission_Element* msg) {
+  return *msg->_impl_.element_.rail_;
+}
+const ::pb::mission::Mission_Element_Segment&
+Mission_Element::_Internal::segment(const Mission_Element* msg) {
+  return *msg->_impl_.element_.segment_;
 }
 void Mission_Element::set_allocated_point(::pb::mission::Mission_Element_Point* point) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_element();
   if (point) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(point);
     if (message_arena != submessage_arena) {
-      point = ::google::protobuf::internal::GetOwnedMessage(
+      point = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, point, submessage_arena);
     }
     set_has_point();
-    element_.point_ = point;
+    _impl_.element_.point_ = point;
   }
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Element.point)
 }
 void Mission_Element::set_allocated_rail(::pb::mission::Mission_Element_Rail* rail) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_element();
   if (rail) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rail);
     if (message_arena != submessage_arena) {
-      rail = ::google::protobuf::internal::GetOwnedMessage(
+      rail = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, rail, submessage_arena);
     }
     set_has_rail();
-    element_.rail_ = rail;
+    _impl_.element_.rail_ = rail;
   }
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Element.rail)
 }
 void Mission_Element::set_allocated_segment(::pb::mission::Mission_Element_Segment* segment) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_element();
   if (segment) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(segment);
     if (message_arena != submessage_arena) {
-      segment = ::google::protobuf::internal::GetOwnedMessage(
+      segment = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, segment, submessage_arena);
     }
     set_has_segment();
-    element_.segment_ = segment;
+    _impl_.element_.segment_ = segment;
   }
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Element.segment)
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Mission_Element::kPointFieldNumber;
-const int Mission_Element::kRailFieldNumber;
-const int Mission_Element::kSegmentFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Mission_Element::Mission_Element()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_mission_2eproto::scc_info_Mission_Element.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:pb.mission.Mission.Element)
+Mission_Element::Mission_Element(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pb.mission.Mission.Element)
 }
 Mission_Element::Mission_Element(const Mission_Element& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Mission_Element* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.element_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_element();
   switch (from.element_case()) {
     case kPoint: {
-      mutable_point()->::pb::mission::Mission_Element_Point::MergeFrom(from.point());
+      _this->_internal_mutable_point()->::pb::mission::Mission_Element_Point::MergeFrom(
+          from._internal_point());
       break;
     }
     case kRail: {
-      mutable_rail()->::pb::mission::Mission_Element_Rail::MergeFrom(from.rail());
+      _this->_internal_mutable_rail()->::pb::mission::Mission_Element_Rail::MergeFrom(
+          from._internal_rail());
       break;
     }
     case kSegment: {
-      mutable_segment()->::pb::mission::Mission_Element_Segment::MergeFrom(from.segment());
+      _this->_internal_mutable_segment()->::pb::mission::Mission_Element_Segment::MergeFrom(
+          from._internal_segment());
       break;
     }
     case ELEMENT_NOT_SET: {
@@ -1345,196 +1265,160 @@ Mission_Element::Mission_Element(const Mission_Element& from)
   // @@protoc_insertion_point(copy_constructor:pb.mission.Mission.Element)
 }
 
-void Mission_Element::SharedCtor() {
+inline void Mission_Element::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.element_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_element();
 }
 
 Mission_Element::~Mission_Element() {
   // @@protoc_insertion_point(destructor:pb.mission.Mission.Element)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Mission_Element::SharedDtor() {
+inline void Mission_Element::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_element()) {
     clear_element();
   }
 }
 
 void Mission_Element::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* Mission_Element::descriptor() {
-  ::protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Mission_Element& Mission_Element::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_mission_2eproto::scc_info_Mission_Element.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Mission_Element::clear_element() {
 // @@protoc_insertion_point(one_of_clear_start:pb.mission.Mission.Element)
   switch (element_case()) {
     case kPoint: {
-      delete element_.point_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.element_.point_;
+      }
       break;
     }
     case kRail: {
-      delete element_.rail_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.element_.rail_;
+      }
       break;
     }
     case kSegment: {
-      delete element_.segment_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.element_.segment_;
+      }
       break;
     }
     case ELEMENT_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = ELEMENT_NOT_SET;
+  _impl_._oneof_case_[0] = ELEMENT_NOT_SET;
 }
 
 
 void Mission_Element::Clear() {
 // @@protoc_insertion_point(message_clear_start:pb.mission.Mission.Element)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   clear_element();
-  _internal_metadata_.Clear();
-}
-
-bool Mission_Element::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:pb.mission.Mission.Element)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Mission_Element::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .pb.mission.Mission.Element.Point point = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_point()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_point(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .pb.mission.Mission.Element.Rail rail = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_rail()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rail(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .pb.mission.Mission.Element.Segment segment = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_segment()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_segment(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:pb.mission.Mission.Element)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:pb.mission.Mission.Element)
-  return false;
-#undef DO_
-}
-
-void Mission_Element::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:pb.mission.Mission.Element)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .pb.mission.Mission.Element.Point point = 1;
-  if (has_point()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->_internal_point(), output);
-  }
-
-  // .pb.mission.Mission.Element.Rail rail = 2;
-  if (has_rail()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_rail(), output);
-  }
-
-  // .pb.mission.Mission.Element.Segment segment = 3;
-  if (has_segment()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->_internal_segment(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:pb.mission.Mission.Element)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Mission_Element::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* Mission_Element::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:pb.mission.Mission.Element)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .pb.mission.Mission.Element.Point point = 1;
-  if (has_point()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->_internal_point(), deterministic, target);
+  if (_internal_has_point()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::point(this),
+        _Internal::point(this).GetCachedSize(), target, stream);
   }
 
   // .pb.mission.Mission.Element.Rail rail = 2;
-  if (has_rail()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_rail(), deterministic, target);
+  if (_internal_has_rail()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::rail(this),
+        _Internal::rail(this).GetCachedSize(), target, stream);
   }
 
   // .pb.mission.Mission.Element.Segment segment = 3;
-  if (has_segment()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->_internal_segment(), deterministic, target);
+  if (_internal_has_segment()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::segment(this),
+        _Internal::segment(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:pb.mission.Mission.Element)
   return target;
@@ -1544,88 +1428,75 @@ size_t Mission_Element::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:pb.mission.Mission.Element)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   switch (element_case()) {
     // .pb.mission.Mission.Element.Point point = 1;
     case kPoint: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *element_.point_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.element_.point_);
       break;
     }
     // .pb.mission.Mission.Element.Rail rail = 2;
     case kRail: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *element_.rail_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.element_.rail_);
       break;
     }
     // .pb.mission.Mission.Element.Segment segment = 3;
     case kSegment: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *element_.segment_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.element_.segment_);
       break;
     }
     case ELEMENT_NOT_SET: {
       break;
     }
   }
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Mission_Element::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:pb.mission.Mission.Element)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Mission_Element* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Mission_Element>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:pb.mission.Mission.Element)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:pb.mission.Mission.Element)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Mission_Element::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Mission_Element::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Mission_Element::GetClassData() const { return &_class_data_; }
+
 
-void Mission_Element::MergeFrom(const Mission_Element& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Element)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void Mission_Element::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Mission_Element*>(&to_msg);
+  auto& from = static_cast<const Mission_Element&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Element)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   switch (from.element_case()) {
     case kPoint: {
-      mutable_point()->::pb::mission::Mission_Element_Point::MergeFrom(from.point());
+      _this->_internal_mutable_point()->::pb::mission::Mission_Element_Point::MergeFrom(
+          from._internal_point());
       break;
     }
     case kRail: {
-      mutable_rail()->::pb::mission::Mission_Element_Rail::MergeFrom(from.rail());
+      _this->_internal_mutable_rail()->::pb::mission::Mission_Element_Rail::MergeFrom(
+          from._internal_rail());
       break;
     }
     case kSegment: {
-      mutable_segment()->::pb::mission::Mission_Element_Segment::MergeFrom(from.segment());
+      _this->_internal_mutable_segment()->::pb::mission::Mission_Element_Segment::MergeFrom(
+          from._internal_segment());
       break;
     }
     case ELEMENT_NOT_SET: {
       break;
     }
   }
-}
-
-void Mission_Element::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:pb.mission.Mission.Element)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Mission_Element::CopyFrom(const Mission_Element& from) {
@@ -1639,208 +1510,175 @@ bool Mission_Element::IsInitialized() const {
   return true;
 }
 
-void Mission_Element::Swap(Mission_Element* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Mission_Element::InternalSwap(Mission_Element* other) {
   using std::swap;
-  swap(element_, other->element_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.element_, other->_impl_.element_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
-::google::protobuf::Metadata Mission_Element::GetMetadata() const {
-  protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Mission_Element::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mission_2eproto_getter, &descriptor_table_mission_2eproto_once,
+      file_level_metadata_mission_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void Mission_Collection::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Mission_Collection::kNameFieldNumber;
-const int Mission_Collection::kElementsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Mission_Collection::_Internal {
+ public:
+};
 
-Mission_Collection::Mission_Collection()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_mission_2eproto::scc_info_Mission_Collection.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:pb.mission.Mission.Collection)
+Mission_Collection::Mission_Collection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pb.mission.Mission.Collection)
 }
 Mission_Collection::Mission_Collection(const Mission_Collection& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      elements_(from.elements_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Mission_Collection* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.elements_){from._impl_.elements_}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:pb.mission.Mission.Collection)
 }
 
-void Mission_Collection::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Mission_Collection::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.elements_){arena}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Mission_Collection::~Mission_Collection() {
   // @@protoc_insertion_point(destructor:pb.mission.Mission.Collection)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Mission_Collection::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Mission_Collection::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.elements_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
 }
 
 void Mission_Collection::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* Mission_Collection::descriptor() {
-  ::protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Mission_Collection& Mission_Collection::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_mission_2eproto::scc_info_Mission_Collection.base);
-  return *internal_default_instance();
-}
-
 
 void Mission_Collection::Clear() {
 // @@protoc_insertion_point(message_clear_start:pb.mission.Mission.Collection)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  elements_.Clear();
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool Mission_Collection::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:pb.mission.Mission.Collection)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.elements_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Mission_Collection::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "pb.mission.Mission.Collection.name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pb.mission.Mission.Collection.name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .pb.mission.Mission.Element elements = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_elements()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_elements(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:pb.mission.Mission.Collection)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:pb.mission.Mission.Collection)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Mission_Collection::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:pb.mission.Mission.Collection)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "pb.mission.Mission.Collection.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // repeated .pb.mission.Mission.Element elements = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->elements_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2,
-      this->elements(static_cast<int>(i)),
-      output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:pb.mission.Mission.Collection)
-}
-
-::google::protobuf::uint8* Mission_Collection::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* Mission_Collection::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:pb.mission.Mission.Collection)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "pb.mission.Mission.Collection.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // repeated .pb.mission.Mission.Element elements = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->elements_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->elements(static_cast<int>(i)), deterministic, target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_elements_size()); i < n; i++) {
+    const auto& repfield = this->_internal_elements(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:pb.mission.Mission.Collection)
   return target;
@@ -1850,68 +1688,47 @@ size_t Mission_Collection::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:pb.mission.Mission.Collection)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .pb.mission.Mission.Element elements = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->elements_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->elements(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_elements_size();
+  for (const auto& msg : this->_impl_.elements_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Mission_Collection::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:pb.mission.Mission.Collection)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Mission_Collection* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Mission_Collection>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:pb.mission.Mission.Collection)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:pb.mission.Mission.Collection)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Mission_Collection::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Mission_Collection::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Mission_Collection::GetClassData() const { return &_class_data_; }
 
-void Mission_Collection::MergeFrom(const Mission_Collection& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Collection)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  elements_.MergeFrom(from.elements_);
-  if (from.name().size() > 0) {
+void Mission_Collection::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Mission_Collection*>(&to_msg);
+  auto& from = static_cast<const Mission_Collection&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Collection)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  _this->_impl_.elements_.MergeFrom(from._impl_.elements_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-}
-
-void Mission_Collection::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:pb.mission.Mission.Collection)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Mission_Collection::CopyFrom(const Mission_Collection& from) {
@@ -1925,84 +1742,95 @@ bool Mission_Collection::IsInitialized() const {
   return true;
 }
 
-void Mission_Collection::Swap(Mission_Collection* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Mission_Collection::InternalSwap(Mission_Collection* other) {
   using std::swap;
-  CastToBase(&elements_)->InternalSwap(CastToBase(&other->elements_));
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.elements_.InternalSwap(&other->_impl_.elements_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata Mission_Collection::GetMetadata() const {
-  protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Mission_Collection::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mission_2eproto_getter, &descriptor_table_mission_2eproto_once,
+      file_level_metadata_mission_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void Mission_Component::InitAsDefaultInstance() {
-  ::pb::mission::_Mission_Component_default_instance_.element_ = const_cast< ::pb::mission::Mission_Element*>(
-      ::pb::mission::Mission_Element::internal_default_instance());
-  ::pb::mission::_Mission_Component_default_instance_.collection_ = const_cast< ::pb::mission::Mission_Collection*>(
-      ::pb::mission::Mission_Collection::internal_default_instance());
+class Mission_Component::_Internal {
+ public:
+  static const ::pb::mission::Mission_Element& element(const Mission_Component* msg);
+  static const ::pb::mission::Mission_Collection& collection(const Mission_Component* msg);
+};
+
+const ::pb::mission::Mission_Element&
+Mission_Component::_Internal::element(const Mission_Component* msg) {
+  return *msg->_impl_.component_.element_;
+}
+const ::pb::mission::Mission_Collection&
+Mission_Component::_Internal::collection(const Mission_Component* msg) {
+  return *msg->_impl_.component_.collection_;
 }
 void Mission_Component::set_allocated_element(::pb::mission::Mission_Element* element) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_component();
   if (element) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(element);
     if (message_arena != submessage_arena) {
-      element = ::google::protobuf::internal::GetOwnedMessage(
+      element = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, element, submessage_arena);
     }
     set_has_element();
-    component_.element_ = element;
+    _impl_.component_.element_ = element;
   }
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Component.element)
 }
 void Mission_Component::set_allocated_collection(::pb::mission::Mission_Collection* collection) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_component();
   if (collection) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(collection);
     if (message_arena != submessage_arena) {
-      collection = ::google::protobuf::internal::GetOwnedMessage(
+      collection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, collection, submessage_arena);
     }
     set_has_collection();
-    component_.collection_ = collection;
+    _impl_.component_.collection_ = collection;
   }
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Component.collection)
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Mission_Component::kElementFieldNumber;
-const int Mission_Component::kCollectionFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Mission_Component::Mission_Component()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_mission_2eproto::scc_info_Mission_Component.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:pb.mission.Mission.Component)
+Mission_Component::Mission_Component(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pb.mission.Mission.Component)
 }
 Mission_Component::Mission_Component(const Mission_Component& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Mission_Component* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.component_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_component();
   switch (from.component_case()) {
     case kElement: {
-      mutable_element()->::pb::mission::Mission_Element::MergeFrom(from.element());
+      _this->_internal_mutable_element()->::pb::mission::Mission_Element::MergeFrom(
+          from._internal_element());
       break;
     }
     case kCollection: {
-      mutable_collection()->::pb::mission::Mission_Collection::MergeFrom(from.collection());
+      _this->_internal_mutable_collection()->::pb::mission::Mission_Collection::MergeFrom(
+          from._internal_collection());
       break;
     }
     case COMPONENT_NOT_SET: {
@@ -2012,167 +1840,139 @@ Mission_Component::Mission_Component(const Mission_Component& from)
   // @@protoc_insertion_point(copy_constructor:pb.mission.Mission.Component)
 }
 
-void Mission_Component::SharedCtor() {
+inline void Mission_Component::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.component_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_component();
 }
 
 Mission_Component::~Mission_Component() {
   // @@protoc_insertion_point(destructor:pb.mission.Mission.Component)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Mission_Component::SharedDtor() {
+inline void Mission_Component::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_component()) {
     clear_component();
   }
 }
 
 void Mission_Component::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* Mission_Component::descriptor() {
-  ::protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const Mission_Component& Mission_Component::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_mission_2eproto::scc_info_Mission_Component.base);
-  return *internal_default_instance();
-}
-
-
 void Mission_Component::clear_component() {
 // @@protoc_insertion_point(one_of_clear_start:pb.mission.Mission.Component)
   switch (component_case()) {
     case kElement: {
-      delete component_.element_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.component_.element_;
+      }
       break;
     }
     case kCollection: {
-      delete component_.collection_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.component_.collection_;
+      }
       break;
     }
     case COMPONENT_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = COMPONENT_NOT_SET;
+  _impl_._oneof_case_[0] = COMPONENT_NOT_SET;
 }
 
 
 void Mission_Component::Clear() {
 // @@protoc_insertion_point(message_clear_start:pb.mission.Mission.Component)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   clear_component();
-  _internal_metadata_.Clear();
-}
-
-bool Mission_Component::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:pb.mission.Mission.Component)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Mission_Component::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .pb.mission.Mission.Element element = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_element()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_element(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .pb.mission.Mission.Collection collection = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_collection()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_collection(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:pb.mission.Mission.Component)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:pb.mission.Mission.Component)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Mission_Component::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:pb.mission.Mission.Component)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .pb.mission.Mission.Element element = 1;
-  if (has_element()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->_internal_element(), output);
-  }
-
-  // .pb.mission.Mission.Collection collection = 2;
-  if (has_collection()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_collection(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:pb.mission.Mission.Component)
-}
-
-::google::protobuf::uint8* Mission_Component::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* Mission_Component::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:pb.mission.Mission.Component)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .pb.mission.Mission.Element element = 1;
-  if (has_element()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->_internal_element(), deterministic, target);
+  if (_internal_has_element()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::element(this),
+        _Internal::element(this).GetCachedSize(), target, stream);
   }
 
   // .pb.mission.Mission.Collection collection = 2;
-  if (has_collection()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_collection(), deterministic, target);
+  if (_internal_has_collection()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::collection(this),
+        _Internal::collection(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:pb.mission.Mission.Component)
   return target;
@@ -2182,77 +1982,63 @@ size_t Mission_Component::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:pb.mission.Mission.Component)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   switch (component_case()) {
     // .pb.mission.Mission.Element element = 1;
     case kElement: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *component_.element_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.component_.element_);
       break;
     }
     // .pb.mission.Mission.Collection collection = 2;
     case kCollection: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *component_.collection_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.component_.collection_);
       break;
     }
     case COMPONENT_NOT_SET: {
       break;
     }
   }
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Mission_Component::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:pb.mission.Mission.Component)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Mission_Component* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Mission_Component>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:pb.mission.Mission.Component)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:pb.mission.Mission.Component)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Mission_Component::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Mission_Component::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Mission_Component::GetClassData() const { return &_class_data_; }
 
-void Mission_Component::MergeFrom(const Mission_Component& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Component)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void Mission_Component::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Mission_Component*>(&to_msg);
+  auto& from = static_cast<const Mission_Component&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission.Component)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   switch (from.component_case()) {
     case kElement: {
-      mutable_element()->::pb::mission::Mission_Element::MergeFrom(from.element());
+      _this->_internal_mutable_element()->::pb::mission::Mission_Element::MergeFrom(
+          from._internal_element());
       break;
     }
     case kCollection: {
-      mutable_collection()->::pb::mission::Mission_Collection::MergeFrom(from.collection());
+      _this->_internal_mutable_collection()->::pb::mission::Mission_Collection::MergeFrom(
+          from._internal_collection());
       break;
     }
     case COMPONENT_NOT_SET: {
       break;
     }
   }
-}
-
-void Mission_Component::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:pb.mission.Mission.Component)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Mission_Component::CopyFrom(const Mission_Component& from) {
@@ -2266,337 +2052,1259 @@ bool Mission_Component::IsInitialized() const {
   return true;
 }
 
-void Mission_Component::Swap(Mission_Component* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Mission_Component::InternalSwap(Mission_Component* other) {
   using std::swap;
-  swap(component_, other->component_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.component_, other->_impl_.component_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
-::google::protobuf::Metadata Mission_Component::GetMetadata() const {
-  protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Mission_Component::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mission_2eproto_getter, &descriptor_table_mission_2eproto_once,
+      file_level_metadata_mission_2eproto[5]);
 }
 
-
 // ===================================================================
 
-void Mission::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Mission::kNameFieldNumber;
-const int Mission::kComponentsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Mission::_Internal {
+ public:
+};
 
-Mission::Mission()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_mission_2eproto::scc_info_Mission.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:pb.mission.Mission)
+Mission::Mission(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pb.mission.Mission)
 }
 Mission::Mission(const Mission& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      components_(from.components_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Mission* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.components_){from._impl_.components_}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:pb.mission.Mission)
 }
 
-void Mission::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Mission::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.components_){arena}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Mission::~Mission() {
   // @@protoc_insertion_point(destructor:pb.mission.Mission)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Mission::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Mission::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.components_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
 }
 
 void Mission::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* Mission::descriptor() {
-  ::protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Mission& Mission::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_mission_2eproto::scc_info_Mission.base);
-  return *internal_default_instance();
-}
-
 
 void Mission::Clear() {
 // @@protoc_insertion_point(message_clear_start:pb.mission.Mission)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  components_.Clear();
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool Mission::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:pb.mission.Mission)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.components_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Mission::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "pb.mission.Mission.name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pb.mission.Mission.name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .pb.mission.Mission.Component components = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_components()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_components(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:pb.mission.Mission)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:pb.mission.Mission)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Mission::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:pb.mission.Mission)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Mission::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pb.mission.Mission)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "pb.mission.Mission.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // repeated .pb.mission.Mission.Component components = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->components_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2,
-      this->components(static_cast<int>(i)),
-      output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_components_size()); i < n; i++) {
+    const auto& repfield = this->_internal_components(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:pb.mission.Mission)
+  // @@protoc_insertion_point(serialize_to_array_end:pb.mission.Mission)
+  return target;
 }
 
-::google::protobuf::uint8* Mission::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:pb.mission.Mission)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+size_t Mission::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pb.mission.Mission)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .pb.mission.Mission.Component components = 2;
+  total_size += 1UL * this->_internal_components_size();
+  for (const auto& msg : this->_impl_.components_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "pb.mission.Mission.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  // repeated .pb.mission.Mission.Component components = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->components_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->components(static_cast<int>(i)), deterministic, target);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Mission::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Mission::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Mission::GetClassData() const { return &_class_data_; }
+
+
+void Mission::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Mission*>(&to_msg);
+  auto& from = static_cast<const Mission&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.components_.MergeFrom(from._impl_.components_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Mission::CopyFrom(const Mission& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pb.mission.Mission)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Mission::IsInitialized() const {
+  return true;
+}
+
+void Mission::InternalSwap(Mission* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.components_.InternalSwap(&other->_impl_.components_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Mission::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mission_2eproto_getter, &descriptor_table_mission_2eproto_once,
+      file_level_metadata_mission_2eproto[6]);
+}
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+// ===================================================================
+
+class MissionIndex_Component::_Internal {
+ public:
+};
+
+MissionIndex_Component::MissionIndex_Component(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pb.mission.MissionIndex.Component)
+}
+MissionIndex_Component::MissionIndex_Component(const MissionIndex_Component& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MissionIndex_Component* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.element_offsets_){from._impl_.element_offsets_}
+    , /*decltype(_impl_._element_offsets_cached_byte_size_)*/{0}
+    , decltype(_impl_.element_sizes_){from._impl_.element_sizes_}
+    , /*decltype(_impl_._element_sizes_cached_byte_size_)*/{0}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.offset_, &from._impl_.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.size_) -
+    reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.size_));
+  // @@protoc_insertion_point(copy_constructor:pb.mission.MissionIndex.Component)
+}
+
+inline void MissionIndex_Component::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.element_offsets_){arena}
+    , /*decltype(_impl_._element_offsets_cached_byte_size_)*/{0}
+    , decltype(_impl_.element_sizes_){arena}
+    , /*decltype(_impl_._element_sizes_cached_byte_size_)*/{0}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.offset_){uint64_t{0u}}
+    , decltype(_impl_.size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MissionIndex_Component::~MissionIndex_Component() {
+  // @@protoc_insertion_point(destructor:pb.mission.MissionIndex.Component)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(serialize_to_array_end:pb.mission.Mission)
+  SharedDtor();
+}
+
+inline void MissionIndex_Component::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.element_offsets_.~RepeatedField();
+  _impl_.element_sizes_.~RepeatedField();
+  _impl_.name_.Destroy();
+}
+
+void MissionIndex_Component::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MissionIndex_Component::Clear() {
+// @@protoc_insertion_point(message_clear_start:pb.mission.MissionIndex.Component)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.element_offsets_.Clear();
+  _impl_.element_sizes_.Clear();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.size_) -
+      reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MissionIndex_Component::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 offset = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pb.mission.MissionIndex.Component.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 element_offsets = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_element_offsets(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_element_offsets(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 element_sizes = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_element_sizes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_element_sizes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MissionIndex_Component::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pb.mission.MissionIndex.Component)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 offset = 1;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_offset(), target);
+  }
+
+  // uint32 size = 2;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_size(), target);
+  }
+
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pb.mission.MissionIndex.Component.name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_name(), target);
+  }
+
+  // repeated uint64 element_offsets = 4;
+  {
+    int byte_size = _impl_._element_offsets_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          4, _internal_element_offsets(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 element_sizes = 5;
+  {
+    int byte_size = _impl_._element_sizes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          5, _internal_element_sizes(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pb.mission.MissionIndex.Component)
   return target;
 }
 
-size_t Mission::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:pb.mission.Mission)
+size_t MissionIndex_Component::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pb.mission.MissionIndex.Component)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 element_offsets = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.element_offsets_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._element_offsets_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  // repeated .pb.mission.Mission.Component components = 2;
+
+  // repeated uint32 element_sizes = 5;
   {
-    unsigned int count = static_cast<unsigned int>(this->components_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->components(static_cast<int>(i)));
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.element_sizes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._element_sizes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  // string name = 1;
-  if (this->name().size() > 0) {
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // uint64 offset = 1;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+  }
 
-void Mission::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:pb.mission.Mission)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Mission* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Mission>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:pb.mission.Mission)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:pb.mission.Mission)
-    MergeFrom(*source);
+  // uint32 size = 2;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_size());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Mission::MergeFrom(const Mission& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.Mission)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MissionIndex_Component::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MissionIndex_Component::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MissionIndex_Component::GetClassData() const { return &_class_data_; }
 
-  components_.MergeFrom(from.components_);
-  if (from.name().size() > 0) {
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+void MissionIndex_Component::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MissionIndex_Component*>(&to_msg);
+  auto& from = static_cast<const MissionIndex_Component&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.MissionIndex.Component)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.element_offsets_.MergeFrom(from._impl_.element_offsets_);
+  _this->_impl_.element_sizes_.MergeFrom(from._impl_.element_sizes_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Mission::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:pb.mission.Mission)
+void MissionIndex_Component::CopyFrom(const MissionIndex_Component& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pb.mission.MissionIndex.Component)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Mission::CopyFrom(const Mission& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:pb.mission.Mission)
+bool MissionIndex_Component::IsInitialized() const {
+  return true;
+}
+
+void MissionIndex_Component::InternalSwap(MissionIndex_Component* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.element_offsets_.InternalSwap(&other->_impl_.element_offsets_);
+  _impl_.element_sizes_.InternalSwap(&other->_impl_.element_sizes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MissionIndex_Component, _impl_.size_)
+      + sizeof(MissionIndex_Component::_impl_.size_)
+      - PROTOBUF_FIELD_OFFSET(MissionIndex_Component, _impl_.offset_)>(
+          reinterpret_cast<char*>(&_impl_.offset_),
+          reinterpret_cast<char*>(&other->_impl_.offset_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MissionIndex_Component::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mission_2eproto_getter, &descriptor_table_mission_2eproto_once,
+      file_level_metadata_mission_2eproto[7]);
+}
+
+// ===================================================================
+
+class MissionIndex::_Internal {
+ public:
+};
+
+MissionIndex::MissionIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pb.mission.MissionIndex)
+}
+MissionIndex::MissionIndex(const MissionIndex& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MissionIndex* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.components_){from._impl_.components_}
+    , decltype(_impl_.header_offset_){}
+    , decltype(_impl_.header_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.header_offset_, &from._impl_.header_offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.header_size_) -
+    reinterpret_cast<char*>(&_impl_.header_offset_)) + sizeof(_impl_.header_size_));
+  // @@protoc_insertion_point(copy_constructor:pb.mission.MissionIndex)
+}
+
+inline void MissionIndex::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.components_){arena}
+    , decltype(_impl_.header_offset_){uint64_t{0u}}
+    , decltype(_impl_.header_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MissionIndex::~MissionIndex() {
+  // @@protoc_insertion_point(destructor:pb.mission.MissionIndex)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MissionIndex::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.components_.~RepeatedPtrField();
+}
+
+void MissionIndex::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MissionIndex::Clear() {
+// @@protoc_insertion_point(message_clear_start:pb.mission.MissionIndex)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.components_.Clear();
+  ::memset(&_impl_.header_offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.header_size_) -
+      reinterpret_cast<char*>(&_impl_.header_offset_)) + sizeof(_impl_.header_size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MissionIndex::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .pb.mission.MissionIndex.Component components = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_components(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 header_offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.header_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 header_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.header_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MissionIndex::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pb.mission.MissionIndex)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .pb.mission.MissionIndex.Component components = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_components_size()); i < n; i++) {
+    const auto& repfield = this->_internal_components(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 header_offset = 2;
+  if (this->_internal_header_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_header_offset(), target);
+  }
+
+  // uint32 header_size = 3;
+  if (this->_internal_header_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_header_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pb.mission.MissionIndex)
+  return target;
+}
+
+size_t MissionIndex::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pb.mission.MissionIndex)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .pb.mission.MissionIndex.Component components = 1;
+  total_size += 1UL * this->_internal_components_size();
+  for (const auto& msg : this->_impl_.components_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 header_offset = 2;
+  if (this->_internal_header_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_header_offset());
+  }
+
+  // uint32 header_size = 3;
+  if (this->_internal_header_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_header_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MissionIndex::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MissionIndex::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MissionIndex::GetClassData() const { return &_class_data_; }
+
+
+void MissionIndex::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MissionIndex*>(&to_msg);
+  auto& from = static_cast<const MissionIndex&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.MissionIndex)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.components_.MergeFrom(from._impl_.components_);
+  if (from._internal_header_offset() != 0) {
+    _this->_internal_set_header_offset(from._internal_header_offset());
+  }
+  if (from._internal_header_size() != 0) {
+    _this->_internal_set_header_size(from._internal_header_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MissionIndex::CopyFrom(const MissionIndex& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pb.mission.MissionIndex)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Mission::IsInitialized() const {
+bool MissionIndex::IsInitialized() const {
   return true;
 }
 
-void Mission::Swap(Mission* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void Mission::InternalSwap(Mission* other) {
+void MissionIndex::InternalSwap(MissionIndex* other) {
   using std::swap;
-  CastToBase(&components_)->InternalSwap(CastToBase(&other->components_));
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.components_.InternalSwap(&other->_impl_.components_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MissionIndex, _impl_.header_size_)
+      + sizeof(MissionIndex::_impl_.header_size_)
+      - PROTOBUF_FIELD_OFFSET(MissionIndex, _impl_.header_offset_)>(
+          reinterpret_cast<char*>(&_impl_.header_offset_),
+          reinterpret_cast<char*>(&other->_impl_.header_offset_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MissionIndex::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mission_2eproto_getter, &descriptor_table_mission_2eproto_once,
+      file_level_metadata_mission_2eproto[8]);
+}
+
+// ===================================================================
+
+class MissionEdit::_Internal {
+ public:
+};
+
+MissionEdit::MissionEdit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:pb.mission.MissionEdit)
+}
+MissionEdit::MissionEdit(const MissionEdit& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MissionEdit* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parent_){from._impl_.parent_}
+    , /*decltype(_impl_._parent_cached_byte_size_)*/{0}
+    , decltype(_impl_.messages_){from._impl_.messages_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.row_){}
+    , decltype(_impl_.count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:pb.mission.MissionEdit)
+}
+
+inline void MissionEdit::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parent_){arena}
+    , /*decltype(_impl_._parent_cached_byte_size_)*/{0}
+    , decltype(_impl_.messages_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.row_){0u}
+    , decltype(_impl_.count_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MissionEdit::~MissionEdit() {
+  // @@protoc_insertion_point(destructor:pb.mission.MissionEdit)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MissionEdit::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.parent_.~RepeatedField();
+  _impl_.messages_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void MissionEdit::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MissionEdit::Clear() {
+// @@protoc_insertion_point(message_clear_start:pb.mission.MissionEdit)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.parent_.Clear();
+  _impl_.messages_.Clear();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.count_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.count_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MissionEdit::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .pb.mission.MissionEdit.Type type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::pb::mission::MissionEdit_Type>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 parent = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_parent(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_parent(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 row = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.row_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 count = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "pb.mission.MissionEdit.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes messages = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_messages();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MissionEdit::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:pb.mission.MissionEdit)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .pb.mission.MissionEdit.Type type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // repeated uint32 parent = 2;
+  {
+    int byte_size = _impl_._parent_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_parent(), byte_size, target);
+    }
+  }
+
+  // uint32 row = 3;
+  if (this->_internal_row() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_row(), target);
+  }
+
+  // uint32 count = 4;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_count(), target);
+  }
+
+  // string name = 5;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "pb.mission.MissionEdit.name");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_name(), target);
+  }
+
+  // repeated bytes messages = 6;
+  for (int i = 0, n = this->_internal_messages_size(); i < n; i++) {
+    const auto& s = this->_internal_messages(i);
+    target = stream->WriteBytes(6, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:pb.mission.MissionEdit)
+  return target;
+}
+
+size_t MissionEdit::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:pb.mission.MissionEdit)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 parent = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.parent_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._parent_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated bytes messages = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.messages_.size());
+  for (int i = 0, n = _impl_.messages_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.messages_.Get(i));
+  }
+
+  // string name = 5;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .pb.mission.MissionEdit.Type type = 1;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // uint32 row = 3;
+  if (this->_internal_row() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_row());
+  }
+
+  // uint32 count = 4;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-::google::protobuf::Metadata Mission::GetMetadata() const {
-  protobuf_mission_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_mission_2eproto::file_level_metadata[kIndexInFileMessages];
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MissionEdit::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MissionEdit::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MissionEdit::GetClassData() const { return &_class_data_; }
+
+
+void MissionEdit::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MissionEdit*>(&to_msg);
+  auto& from = static_cast<const MissionEdit&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:pb.mission.MissionEdit)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.parent_.MergeFrom(from._impl_.parent_);
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_row() != 0) {
+    _this->_internal_set_row(from._internal_row());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
+void MissionEdit::CopyFrom(const MissionEdit& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:pb.mission.MissionEdit)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MissionEdit::IsInitialized() const {
+  return true;
+}
+
+void MissionEdit::InternalSwap(MissionEdit* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.parent_.InternalSwap(&other->_impl_.parent_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MissionEdit, _impl_.count_)
+      + sizeof(MissionEdit::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(MissionEdit, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MissionEdit::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mission_2eproto_getter, &descriptor_table_mission_2eproto_once,
+      file_level_metadata_mission_2eproto[9]);
+}
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace mission
 }  // namespace pb
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::pb::mission::Mission_Element_Point* Arena::CreateMaybeMessage< ::pb::mission::Mission_Element_Point >(Arena* arena) {
-  return Arena::CreateInternal< ::pb::mission::Mission_Element_Point >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::pb::mission::Mission_Element_Point*
+Arena::CreateMaybeMessage< ::pb::mission::Mission_Element_Point >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pb::mission::Mission_Element_Point >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pb::mission::Mission_Element_Rail*
+Arena::CreateMaybeMessage< ::pb::mission::Mission_Element_Rail >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pb::mission::Mission_Element_Rail >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pb::mission::Mission_Element_Segment*
+Arena::CreateMaybeMessage< ::pb::mission::Mission_Element_Segment >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pb::mission::Mission_Element_Segment >(arena);
+}
+template<> PROTOBUF_NOINLINE ::pb::mission::Mission_Element*
+Arena::CreateMaybeMessage< ::pb::mission::Mission_Element >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pb::mission::Mission_Element >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::pb::mission::Mission_Element_Rail* Arena::CreateMaybeMessage< ::pb::mission::Mission_Element_Rail >(Arena* arena) {
-  return Arena::CreateInternal< ::pb::mission::Mission_Element_Rail >(arena);
+template<> PROTOBUF_NOINLINE ::pb::mission::Mission_Collection*
+Arena::CreateMaybeMessage< ::pb::mission::Mission_Collection >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pb::mission::Mission_Collection >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::pb::mission::Mission_Element_Segment* Arena::CreateMaybeMessage< ::pb::mission::Mission_Element_Segment >(Arena* arena) {
-  return Arena::CreateInternal< ::pb::mission::Mission_Element_Segment >(arena);
+template<> PROTOBUF_NOINLINE ::pb::mission::Mission_Component*
+Arena::CreateMaybeMessage< ::pb::mission::Mission_Component >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pb::mission::Mission_Component >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::pb::mission::Mission_Element* Arena::CreateMaybeMessage< ::pb::mission::Mission_Element >(Arena* arena) {
-  return Arena::CreateInternal< ::pb::mission::Mission_Element >(arena);
+template<> PROTOBUF_NOINLINE ::pb::mission::Mission*
+Arena::CreateMaybeMessage< ::pb::mission::Mission >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pb::mission::Mission >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::pb::mission::Mission_Collection* Arena::CreateMaybeMessage< ::pb::mission::Mission_Collection >(Arena* arena) {
-  return Arena::CreateInternal< ::pb::mission::Mission_Collection >(arena);
+template<> PROTOBUF_NOINLINE ::pb::mission::MissionIndex_Component*
+Arena::CreateMaybeMessage< ::pb::mission::MissionIndex_Component >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pb::mission::MissionIndex_Component >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::pb::mission::Mission_Component* Arena::CreateMaybeMessage< ::pb::mission::Mission_Component >(Arena* arena) {
-  return Arena::CreateInternal< ::pb::mission::Mission_Component >(arena);
+template<> PROTOBUF_NOINLINE ::pb::mission::MissionIndex*
+Arena::CreateMaybeMessage< ::pb::mission::MissionIndex >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pb::mission::MissionIndex >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::pb::mission::Mission* Arena::CreateMaybeMessage< ::pb::mission::Mission >(Arena* arena) {
-  return Arena::CreateInternal< ::pb::mission::Mission >(arena);
+template<> PROTOBUF_NOINLINE ::pb::mission::MissionEdit*
+Arena::CreateMaybeMessage< ::pb::mission::MissionEdit >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::pb::mission::MissionEdit >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
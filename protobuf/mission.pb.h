@@ -1,121 +1,171 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: mission.proto
 
-#ifndef PROTOBUF_INCLUDED_mission_2eproto
-#define PROTOBUF_INCLUDED_mission_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_mission_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_mission_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_mission_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_mission_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_mission_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[7];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_mission_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_mission_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_mission_2eproto;
 namespace pb {
 namespace mission {
 class Mission;
-class MissionDefaultTypeInternal;
+struct MissionDefaultTypeInternal;
 extern MissionDefaultTypeInternal _Mission_default_instance_;
+class MissionEdit;
+struct MissionEditDefaultTypeInternal;
+extern MissionEditDefaultTypeInternal _MissionEdit_default_instance_;
+class MissionIndex;
+struct MissionIndexDefaultTypeInternal;
+extern MissionIndexDefaultTypeInternal _MissionIndex_default_instance_;
+class MissionIndex_Component;
+struct MissionIndex_ComponentDefaultTypeInternal;
+extern MissionIndex_ComponentDefaultTypeInternal _MissionIndex_Component_default_instance_;
 class Mission_Collection;
-class Mission_CollectionDefaultTypeInternal;
+struct Mission_CollectionDefaultTypeInternal;
 extern Mission_CollectionDefaultTypeInternal _Mission_Collection_default_instance_;
 class Mission_Component;
-class Mission_ComponentDefaultTypeInternal;
+struct Mission_ComponentDefaultTypeInternal;
 extern Mission_ComponentDefaultTypeInternal _Mission_Component_default_instance_;
 class Mission_Element;
-class Mission_ElementDefaultTypeInternal;
+struct Mission_ElementDefaultTypeInternal;
 extern Mission_ElementDefaultTypeInternal _Mission_Element_default_instance_;
 class Mission_Element_Point;
-class Mission_Element_PointDefaultTypeInternal;
+struct Mission_Element_PointDefaultTypeInternal;
 extern Mission_Element_PointDefaultTypeInternal _Mission_Element_Point_default_instance_;
 class Mission_Element_Rail;
-class Mission_Element_RailDefaultTypeInternal;
+struct Mission_Element_RailDefaultTypeInternal;
 extern Mission_Element_RailDefaultTypeInternal _Mission_Element_Rail_default_instance_;
 class Mission_Element_Segment;
-class Mission_Element_SegmentDefaultTypeInternal;
+struct Mission_Element_SegmentDefaultTypeInternal;
 extern Mission_Element_SegmentDefaultTypeInternal _Mission_Element_Segment_default_instance_;
 }  // namespace mission
 }  // namespace pb
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 template<> ::pb::mission::Mission* Arena::CreateMaybeMessage<::pb::mission::Mission>(Arena*);
+template<> ::pb::mission::MissionEdit* Arena::CreateMaybeMessage<::pb::mission::MissionEdit>(Arena*);
+template<> ::pb::mission::MissionIndex* Arena::CreateMaybeMessage<::pb::mission::MissionIndex>(Arena*);
+template<> ::pb::mission::MissionIndex_Component* Arena::CreateMaybeMessage<::pb::mission::MissionIndex_Component>(Arena*);
 template<> ::pb::mission::Mission_Collection* Arena::CreateMaybeMessage<::pb::mission::Mission_Collection>(Arena*);
 template<> ::pb::mission::Mission_Component* Arena::CreateMaybeMessage<::pb::mission::Mission_Component>(Arena*);
 template<> ::pb::mission::Mission_Element* Arena::CreateMaybeMessage<::pb::mission::Mission_Element>(Arena*);
 template<> ::pb::mission::Mission_Element_Point* Arena::CreateMaybeMessage<::pb::mission::Mission_Element_Point>(Arena*);
 template<> ::pb::mission::Mission_Element_Rail* Arena::CreateMaybeMessage<::pb::mission::Mission_Element_Rail>(Arena*);
 template<> ::pb::mission::Mission_Element_Segment* Arena::CreateMaybeMessage<::pb::mission::Mission_Element_Segment>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace pb {
 namespace mission {
 
+enum MissionEdit_Type : int {
+  MissionEdit_Type_kAddPoint = 0,
+  MissionEdit_Type_kAddRail = 1,
+  MissionEdit_Type_kRemove = 2,
+  MissionEdit_Type_kInsert = 3,
+  MissionEdit_Type_MissionEdit_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MissionEdit_Type_MissionEdit_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool MissionEdit_Type_IsValid(int value);
+constexpr MissionEdit_Type MissionEdit_Type_Type_MIN = MissionEdit_Type_kAddPoint;
+constexpr MissionEdit_Type MissionEdit_Type_Type_MAX = MissionEdit_Type_kInsert;
+constexpr int MissionEdit_Type_Type_ARRAYSIZE = MissionEdit_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MissionEdit_Type_descriptor();
+template<typename T>
+inline const std::string& MissionEdit_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MissionEdit_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MissionEdit_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MissionEdit_Type_descriptor(), enum_t_value);
+}
+inline bool MissionEdit_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MissionEdit_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MissionEdit_Type>(
+    MissionEdit_Type_descriptor(), name, value);
+}
 // ===================================================================
 
-class Mission_Element_Point : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Element.Point) */ {
+class Mission_Element_Point final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Element.Point) */ {
  public:
-  Mission_Element_Point();
-  virtual ~Mission_Element_Point();
+  inline Mission_Element_Point() : Mission_Element_Point(nullptr) {}
+  ~Mission_Element_Point() override;
+  explicit PROTOBUF_CONSTEXPR Mission_Element_Point(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Mission_Element_Point(const Mission_Element_Point& from);
-
-  inline Mission_Element_Point& operator=(const Mission_Element_Point& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Mission_Element_Point(Mission_Element_Point&& from) noexcept
     : Mission_Element_Point() {
     *this = ::std::move(from);
   }
 
+  inline Mission_Element_Point& operator=(const Mission_Element_Point& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Mission_Element_Point& operator=(Mission_Element_Point&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Mission_Element_Point& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mission_Element_Point& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Mission_Element_Point* internal_default_instance() {
     return reinterpret_cast<const Mission_Element_Point*>(
                &_Mission_Element_Point_default_instance_);
@@ -123,110 +173,152 @@ class Mission_Element_Point : public ::google::protobuf::Message /* @@protoc_ins
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(Mission_Element_Point* other);
   friend void swap(Mission_Element_Point& a, Mission_Element_Point& b) {
     a.Swap(&b);
   }
+  inline void Swap(Mission_Element_Point* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mission_Element_Point* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Mission_Element_Point* New() const final {
-    return CreateMaybeMessage<Mission_Element_Point>(NULL);
-  }
-
-  Mission_Element_Point* New(::google::protobuf::Arena* arena) const final {
+  Mission_Element_Point* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Mission_Element_Point>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Mission_Element_Point& from);
-  void MergeFrom(const Mission_Element_Point& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Mission_Element_Point& from) {
+    Mission_Element_Point::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Mission_Element_Point* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pb.mission.Mission.Element.Point";
   }
+  protected:
+  explicit Mission_Element_Point(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:pb.mission.Mission.Element.Point)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_mission_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mission_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Mission_Element_Rail : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Element.Rail) */ {
+class Mission_Element_Rail final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Element.Rail) */ {
  public:
-  Mission_Element_Rail();
-  virtual ~Mission_Element_Rail();
+  inline Mission_Element_Rail() : Mission_Element_Rail(nullptr) {}
+  ~Mission_Element_Rail() override;
+  explicit PROTOBUF_CONSTEXPR Mission_Element_Rail(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Mission_Element_Rail(const Mission_Element_Rail& from);
-
-  inline Mission_Element_Rail& operator=(const Mission_Element_Rail& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Mission_Element_Rail(Mission_Element_Rail&& from) noexcept
     : Mission_Element_Rail() {
     *this = ::std::move(from);
   }
 
+  inline Mission_Element_Rail& operator=(const Mission_Element_Rail& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Mission_Element_Rail& operator=(Mission_Element_Rail&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Mission_Element_Rail& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mission_Element_Rail& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Mission_Element_Rail* internal_default_instance() {
     return reinterpret_cast<const Mission_Element_Rail*>(
                &_Mission_Element_Rail_default_instance_);
@@ -234,136 +326,192 @@ class Mission_Element_Rail : public ::google::protobuf::Message /* @@protoc_inse
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(Mission_Element_Rail* other);
   friend void swap(Mission_Element_Rail& a, Mission_Element_Rail& b) {
     a.Swap(&b);
   }
+  inline void Swap(Mission_Element_Rail* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mission_Element_Rail* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Mission_Element_Rail* New() const final {
-    return CreateMaybeMessage<Mission_Element_Rail>(NULL);
-  }
-
-  Mission_Element_Rail* New(::google::protobuf::Arena* arena) const final {
+  Mission_Element_Rail* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Mission_Element_Rail>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Mission_Element_Rail& from);
-  void MergeFrom(const Mission_Element_Rail& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Mission_Element_Rail& from) {
+    Mission_Element_Rail::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Mission_Element_Rail* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pb.mission.Mission.Element.Rail";
   }
+  protected:
+  explicit Mission_Element_Rail(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kP0FieldNumber = 2,
+    kP1FieldNumber = 3,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // .pb.mission.Mission.Element.Point p0 = 2;
   bool has_p0() const;
-  void clear_p0();
-  static const int kP0FieldNumber = 2;
   private:
-  const ::pb::mission::Mission_Element_Point& _internal_p0() const;
+  bool _internal_has_p0() const;
   public:
+  void clear_p0();
   const ::pb::mission::Mission_Element_Point& p0() const;
-  ::pb::mission::Mission_Element_Point* release_p0();
+  PROTOBUF_NODISCARD ::pb::mission::Mission_Element_Point* release_p0();
   ::pb::mission::Mission_Element_Point* mutable_p0();
   void set_allocated_p0(::pb::mission::Mission_Element_Point* p0);
+  private:
+  const ::pb::mission::Mission_Element_Point& _internal_p0() const;
+  ::pb::mission::Mission_Element_Point* _internal_mutable_p0();
+  public:
+  void unsafe_arena_set_allocated_p0(
+      ::pb::mission::Mission_Element_Point* p0);
+  ::pb::mission::Mission_Element_Point* unsafe_arena_release_p0();
 
   // .pb.mission.Mission.Element.Point p1 = 3;
   bool has_p1() const;
-  void clear_p1();
-  static const int kP1FieldNumber = 3;
   private:
-  const ::pb::mission::Mission_Element_Point& _internal_p1() const;
+  bool _internal_has_p1() const;
   public:
+  void clear_p1();
   const ::pb::mission::Mission_Element_Point& p1() const;
-  ::pb::mission::Mission_Element_Point* release_p1();
+  PROTOBUF_NODISCARD ::pb::mission::Mission_Element_Point* release_p1();
   ::pb::mission::Mission_Element_Point* mutable_p1();
   void set_allocated_p1(::pb::mission::Mission_Element_Point* p1);
+  private:
+  const ::pb::mission::Mission_Element_Point& _internal_p1() const;
+  ::pb::mission::Mission_Element_Point* _internal_mutable_p1();
+  public:
+  void unsafe_arena_set_allocated_p1(
+      ::pb::mission::Mission_Element_Point* p1);
+  ::pb::mission::Mission_Element_Point* unsafe_arena_release_p1();
 
   // @@protoc_insertion_point(class_scope:pb.mission.Mission.Element.Rail)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::pb::mission::Mission_Element_Point* p0_;
-  ::pb::mission::Mission_Element_Point* p1_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_mission_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::pb::mission::Mission_Element_Point* p0_;
+    ::pb::mission::Mission_Element_Point* p1_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mission_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Mission_Element_Segment : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Element.Segment) */ {
+class Mission_Element_Segment final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Element.Segment) */ {
  public:
-  Mission_Element_Segment();
-  virtual ~Mission_Element_Segment();
+  inline Mission_Element_Segment() : Mission_Element_Segment(nullptr) {}
+  ~Mission_Element_Segment() override;
+  explicit PROTOBUF_CONSTEXPR Mission_Element_Segment(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Mission_Element_Segment(const Mission_Element_Segment& from);
-
-  inline Mission_Element_Segment& operator=(const Mission_Element_Segment& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Mission_Element_Segment(Mission_Element_Segment&& from) noexcept
     : Mission_Element_Segment() {
     *this = ::std::move(from);
   }
 
+  inline Mission_Element_Segment& operator=(const Mission_Element_Segment& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Mission_Element_Segment& operator=(Mission_Element_Segment&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Mission_Element_Segment& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mission_Element_Segment& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Mission_Element_Segment* internal_default_instance() {
     return reinterpret_cast<const Mission_Element_Segment*>(
                &_Mission_Element_Segment_default_instance_);
@@ -371,135 +519,192 @@ class Mission_Element_Segment : public ::google::protobuf::Message /* @@protoc_i
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(Mission_Element_Segment* other);
   friend void swap(Mission_Element_Segment& a, Mission_Element_Segment& b) {
     a.Swap(&b);
   }
+  inline void Swap(Mission_Element_Segment* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mission_Element_Segment* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Mission_Element_Segment* New() const final {
-    return CreateMaybeMessage<Mission_Element_Segment>(NULL);
-  }
-
-  Mission_Element_Segment* New(::google::protobuf::Arena* arena) const final {
+  Mission_Element_Segment* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Mission_Element_Segment>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Mission_Element_Segment& from);
-  void MergeFrom(const Mission_Element_Segment& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Mission_Element_Segment& from) {
+    Mission_Element_Segment::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Mission_Element_Segment* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pb.mission.Mission.Element.Segment";
   }
+  protected:
+  explicit Mission_Element_Segment(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kP0FieldNumber = 2,
+    kP1FieldNumber = 3,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // .pb.mission.Mission.Element.Point p0 = 2;
   bool has_p0() const;
-  void clear_p0();
-  static const int kP0FieldNumber = 2;
   private:
-  const ::pb::mission::Mission_Element_Point& _internal_p0() const;
+  bool _internal_has_p0() const;
   public:
+  void clear_p0();
   const ::pb::mission::Mission_Element_Point& p0() const;
-  ::pb::mission::Mission_Element_Point* release_p0();
+  PROTOBUF_NODISCARD ::pb::mission::Mission_Element_Point* release_p0();
   ::pb::mission::Mission_Element_Point* mutable_p0();
   void set_allocated_p0(::pb::mission::Mission_Element_Point* p0);
+  private:
+  const ::pb::mission::Mission_Element_Point& _internal_p0() const;
+  ::pb::mission::Mission_Element_Point* _internal_mutable_p0();
+  public:
+  void unsafe_arena_set_allocated_p0(
+      ::pb::mission::Mission_Element_Point* p0);
+  ::pb::mission::Mission_Element_Point* unsafe_arena_release_p0();
 
   // .pb.mission.Mission.Element.Point p1 = 3;
   bool has_p1() const;
-  void clear_p1();
-  static const int kP1FieldNumber = 3;
   private:
-  const ::pb::mission::Mission_Element_Point& _internal_p1() const;
+  bool _internal_has_p1() const;
   public:
+  void clear_p1();
   const ::pb::mission::Mission_Element_Point& p1() const;
-  ::pb::mission::Mission_Element_Point* release_p1();
+  PROTOBUF_NODISCARD ::pb::mission::Mission_Element_Point* release_p1();
   ::pb::mission::Mission_Element_Point* mutable_p1();
   void set_allocated_p1(::pb::mission::Mission_Element_Point* p1);
+  private:
+  const ::pb::mission::Mission_Element_Point& _internal_p1() const;
+  ::pb::mission::Mission_Element_Point* _internal_mutable_p1();
+  public:
+  void unsafe_arena_set_allocated_p1(
+      ::pb::mission::Mission_Element_Point* p1);
+  ::pb::mission::Mission_Element_Point* unsafe_arena_release_p1();
 
   // @@protoc_insertion_point(class_scope:pb.mission.Mission.Element.Segment)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::pb::mission::Mission_Element_Point* p0_;
-  ::pb::mission::Mission_Element_Point* p1_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_mission_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::pb::mission::Mission_Element_Point* p0_;
+    ::pb::mission::Mission_Element_Point* p1_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mission_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Mission_Element : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Element) */ {
+class Mission_Element final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Element) */ {
  public:
-  Mission_Element();
-  virtual ~Mission_Element();
+  inline Mission_Element() : Mission_Element(nullptr) {}
+  ~Mission_Element() override;
+  explicit PROTOBUF_CONSTEXPR Mission_Element(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Mission_Element(const Mission_Element& from);
-
-  inline Mission_Element& operator=(const Mission_Element& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Mission_Element(Mission_Element&& from) noexcept
     : Mission_Element() {
     *this = ::std::move(from);
   }
 
+  inline Mission_Element& operator=(const Mission_Element& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Mission_Element& operator=(Mission_Element&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Mission_Element& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mission_Element& default_instance() {
+    return *internal_default_instance();
+  }
   enum ElementCase {
     kPoint = 1,
     kRail = 2,
@@ -507,7 +712,6 @@ class Mission_Element : public ::google::protobuf::Message /* @@protoc_insertion
     ELEMENT_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Mission_Element* internal_default_instance() {
     return reinterpret_cast<const Mission_Element*>(
                &_Mission_Element_default_instance_);
@@ -515,51 +719,71 @@ class Mission_Element : public ::google::protobuf::Message /* @@protoc_insertion
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(Mission_Element* other);
   friend void swap(Mission_Element& a, Mission_Element& b) {
     a.Swap(&b);
   }
+  inline void Swap(Mission_Element* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mission_Element* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Mission_Element* New() const final {
-    return CreateMaybeMessage<Mission_Element>(NULL);
-  }
-
-  Mission_Element* New(::google::protobuf::Arena* arena) const final {
+  Mission_Element* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Mission_Element>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Mission_Element& from);
-  void MergeFrom(const Mission_Element& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Mission_Element& from) {
+    Mission_Element::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Mission_Element* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pb.mission.Mission.Element";
   }
+  protected:
+  explicit Mission_Element(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -569,46 +793,70 @@ class Mission_Element : public ::google::protobuf::Message /* @@protoc_insertion
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPointFieldNumber = 1,
+    kRailFieldNumber = 2,
+    kSegmentFieldNumber = 3,
+  };
   // .pb.mission.Mission.Element.Point point = 1;
   bool has_point() const;
-  void clear_point();
-  static const int kPointFieldNumber = 1;
   private:
-  const ::pb::mission::Mission_Element_Point& _internal_point() const;
+  bool _internal_has_point() const;
   public:
+  void clear_point();
   const ::pb::mission::Mission_Element_Point& point() const;
-  ::pb::mission::Mission_Element_Point* release_point();
+  PROTOBUF_NODISCARD ::pb::mission::Mission_Element_Point* release_point();
   ::pb::mission::Mission_Element_Point* mutable_point();
   void set_allocated_point(::pb::mission::Mission_Element_Point* point);
+  private:
+  const ::pb::mission::Mission_Element_Point& _internal_point() const;
+  ::pb::mission::Mission_Element_Point* _internal_mutable_point();
+  public:
+  void unsafe_arena_set_allocated_point(
+      ::pb::mission::Mission_Element_Point* point);
+  ::pb::mission::Mission_Element_Point* unsafe_arena_release_point();
 
   // .pb.mission.Mission.Element.Rail rail = 2;
   bool has_rail() const;
-  void clear_rail();
-  static const int kRailFieldNumber = 2;
   private:
-  const ::pb::mission::Mission_Element_Rail& _internal_rail() const;
+  bool _internal_has_rail() const;
   public:
+  void clear_rail();
   const ::pb::mission::Mission_Element_Rail& rail() const;
-  ::pb::mission::Mission_Element_Rail* release_rail();
+  PROTOBUF_NODISCARD ::pb::mission::Mission_Element_Rail* release_rail();
   ::pb::mission::Mission_Element_Rail* mutable_rail();
   void set_allocated_rail(::pb::mission::Mission_Element_Rail* rail);
+  private:
+  const ::pb::mission::Mission_Element_Rail& _internal_rail() const;
+  ::pb::mission::Mission_Element_Rail* _internal_mutable_rail();
+  public:
+  void unsafe_arena_set_allocated_rail(
+      ::pb::mission::Mission_Element_Rail* rail);
+  ::pb::mission::Mission_Element_Rail* unsafe_arena_release_rail();
 
   // .pb.mission.Mission.Element.Segment segment = 3;
   bool has_segment() const;
-  void clear_segment();
-  static const int kSegmentFieldNumber = 3;
   private:
-  const ::pb::mission::Mission_Element_Segment& _internal_segment() const;
+  bool _internal_has_segment() const;
   public:
+  void clear_segment();
   const ::pb::mission::Mission_Element_Segment& segment() const;
-  ::pb::mission::Mission_Element_Segment* release_segment();
+  PROTOBUF_NODISCARD ::pb::mission::Mission_Element_Segment* release_segment();
   ::pb::mission::Mission_Element_Segment* mutable_segment();
   void set_allocated_segment(::pb::mission::Mission_Element_Segment* segment);
+  private:
+  const ::pb::mission::Mission_Element_Segment& _internal_segment() const;
+  ::pb::mission::Mission_Element_Segment* _internal_mutable_segment();
+  public:
+  void unsafe_arena_set_allocated_segment(
+      ::pb::mission::Mission_Element_Segment* segment);
+  ::pb::mission::Mission_Element_Segment* unsafe_arena_release_segment();
 
   void clear_element();
   ElementCase element_case() const;
   // @@protoc_insertion_point(class_scope:pb.mission.Mission.Element)
  private:
+  class _Internal;
   void set_has_point();
   void set_has_rail();
   void set_has_segment();
@@ -616,50 +864,69 @@ class Mission_Element : public ::google::protobuf::Message /* @@protoc_insertion
   inline bool has_element() const;
   inline void clear_has_element();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  union ElementUnion {
-    ElementUnion() {}
-    ::pb::mission::Mission_Element_Point* point_;
-    ::pb::mission::Mission_Element_Rail* rail_;
-    ::pb::mission::Mission_Element_Segment* segment_;
-  } element_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend struct ::protobuf_mission_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union ElementUnion {
+      constexpr ElementUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::pb::mission::Mission_Element_Point* point_;
+      ::pb::mission::Mission_Element_Rail* rail_;
+      ::pb::mission::Mission_Element_Segment* segment_;
+    } element_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mission_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Mission_Collection : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Collection) */ {
+class Mission_Collection final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Collection) */ {
  public:
-  Mission_Collection();
-  virtual ~Mission_Collection();
+  inline Mission_Collection() : Mission_Collection(nullptr) {}
+  ~Mission_Collection() override;
+  explicit PROTOBUF_CONSTEXPR Mission_Collection(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Mission_Collection(const Mission_Collection& from);
-
-  inline Mission_Collection& operator=(const Mission_Collection& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Mission_Collection(Mission_Collection&& from) noexcept
     : Mission_Collection() {
     *this = ::std::move(from);
   }
 
+  inline Mission_Collection& operator=(const Mission_Collection& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Mission_Collection& operator=(Mission_Collection&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Mission_Collection& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mission_Collection& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Mission_Collection* internal_default_instance() {
     return reinterpret_cast<const Mission_Collection*>(
                &_Mission_Collection_default_instance_);
@@ -667,129 +934,178 @@ class Mission_Collection : public ::google::protobuf::Message /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(Mission_Collection* other);
   friend void swap(Mission_Collection& a, Mission_Collection& b) {
     a.Swap(&b);
   }
+  inline void Swap(Mission_Collection* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mission_Collection* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Mission_Collection* New() const final {
-    return CreateMaybeMessage<Mission_Collection>(NULL);
-  }
-
-  Mission_Collection* New(::google::protobuf::Arena* arena) const final {
+  Mission_Collection* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Mission_Collection>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Mission_Collection& from);
-  void MergeFrom(const Mission_Collection& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Mission_Collection& from) {
+    Mission_Collection::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Mission_Collection* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pb.mission.Mission.Collection";
   }
+  protected:
+  explicit Mission_Collection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kElementsFieldNumber = 2,
+    kNameFieldNumber = 1,
+  };
   // repeated .pb.mission.Mission.Element elements = 2;
   int elements_size() const;
+  private:
+  int _internal_elements_size() const;
+  public:
   void clear_elements();
-  static const int kElementsFieldNumber = 2;
   ::pb::mission::Mission_Element* mutable_elements(int index);
-  ::google::protobuf::RepeatedPtrField< ::pb::mission::Mission_Element >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::Mission_Element >*
       mutable_elements();
+  private:
+  const ::pb::mission::Mission_Element& _internal_elements(int index) const;
+  ::pb::mission::Mission_Element* _internal_add_elements();
+  public:
   const ::pb::mission::Mission_Element& elements(int index) const;
   ::pb::mission::Mission_Element* add_elements();
-  const ::google::protobuf::RepeatedPtrField< ::pb::mission::Mission_Element >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::Mission_Element >&
       elements() const;
 
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:pb.mission.Mission.Collection)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::pb::mission::Mission_Element > elements_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_mission_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::Mission_Element > elements_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mission_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Mission_Component : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Component) */ {
+class Mission_Component final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission.Component) */ {
  public:
-  Mission_Component();
-  virtual ~Mission_Component();
+  inline Mission_Component() : Mission_Component(nullptr) {}
+  ~Mission_Component() override;
+  explicit PROTOBUF_CONSTEXPR Mission_Component(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Mission_Component(const Mission_Component& from);
-
-  inline Mission_Component& operator=(const Mission_Component& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Mission_Component(Mission_Component&& from) noexcept
     : Mission_Component() {
     *this = ::std::move(from);
   }
 
+  inline Mission_Component& operator=(const Mission_Component& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Mission_Component& operator=(Mission_Component&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Mission_Component& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mission_Component& default_instance() {
+    return *internal_default_instance();
+  }
   enum ComponentCase {
     kElement = 1,
     kCollection = 2,
     COMPONENT_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Mission_Component* internal_default_instance() {
     return reinterpret_cast<const Mission_Component*>(
                &_Mission_Component_default_instance_);
@@ -797,133 +1113,189 @@ class Mission_Component : public ::google::protobuf::Message /* @@protoc_inserti
   static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(Mission_Component* other);
   friend void swap(Mission_Component& a, Mission_Component& b) {
     a.Swap(&b);
   }
+  inline void Swap(Mission_Component* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mission_Component* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Mission_Component* New() const final {
-    return CreateMaybeMessage<Mission_Component>(NULL);
-  }
-
-  Mission_Component* New(::google::protobuf::Arena* arena) const final {
+  Mission_Component* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Mission_Component>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Mission_Component& from);
-  void MergeFrom(const Mission_Component& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Mission_Component& from) {
+    Mission_Component::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Mission_Component* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pb.mission.Mission.Component";
   }
+  protected:
+  explicit Mission_Component(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kElementFieldNumber = 1,
+    kCollectionFieldNumber = 2,
+  };
   // .pb.mission.Mission.Element element = 1;
   bool has_element() const;
-  void clear_element();
-  static const int kElementFieldNumber = 1;
   private:
-  const ::pb::mission::Mission_Element& _internal_element() const;
+  bool _internal_has_element() const;
   public:
+  void clear_element();
   const ::pb::mission::Mission_Element& element() const;
-  ::pb::mission::Mission_Element* release_element();
+  PROTOBUF_NODISCARD ::pb::mission::Mission_Element* release_element();
   ::pb::mission::Mission_Element* mutable_element();
   void set_allocated_element(::pb::mission::Mission_Element* element);
+  private:
+  const ::pb::mission::Mission_Element& _internal_element() const;
+  ::pb::mission::Mission_Element* _internal_mutable_element();
+  public:
+  void unsafe_arena_set_allocated_element(
+      ::pb::mission::Mission_Element* element);
+  ::pb::mission::Mission_Element* unsafe_arena_release_element();
 
   // .pb.mission.Mission.Collection collection = 2;
   bool has_collection() const;
-  void clear_collection();
-  static const int kCollectionFieldNumber = 2;
   private:
-  const ::pb::mission::Mission_Collection& _internal_collection() const;
+  bool _internal_has_collection() const;
   public:
+  void clear_collection();
   const ::pb::mission::Mission_Collection& collection() const;
-  ::pb::mission::Mission_Collection* release_collection();
+  PROTOBUF_NODISCARD ::pb::mission::Mission_Collection* release_collection();
   ::pb::mission::Mission_Collection* mutable_collection();
   void set_allocated_collection(::pb::mission::Mission_Collection* collection);
+  private:
+  const ::pb::mission::Mission_Collection& _internal_collection() const;
+  ::pb::mission::Mission_Collection* _internal_mutable_collection();
+  public:
+  void unsafe_arena_set_allocated_collection(
+      ::pb::mission::Mission_Collection* collection);
+  ::pb::mission::Mission_Collection* unsafe_arena_release_collection();
 
   void clear_component();
   ComponentCase component_case() const;
   // @@protoc_insertion_point(class_scope:pb.mission.Mission.Component)
  private:
+  class _Internal;
   void set_has_element();
   void set_has_collection();
 
   inline bool has_component() const;
   inline void clear_has_component();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  union ComponentUnion {
-    ComponentUnion() {}
-    ::pb::mission::Mission_Element* element_;
-    ::pb::mission::Mission_Collection* collection_;
-  } component_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union ComponentUnion {
+      constexpr ComponentUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::pb::mission::Mission_Element* element_;
+      ::pb::mission::Mission_Collection* collection_;
+    } component_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
-  friend struct ::protobuf_mission_2eproto::TableStruct;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mission_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Mission : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission) */ {
+class Mission final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pb.mission.Mission) */ {
  public:
-  Mission();
-  virtual ~Mission();
+  inline Mission() : Mission(nullptr) {}
+  ~Mission() override;
+  explicit PROTOBUF_CONSTEXPR Mission(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Mission(const Mission& from);
-
-  inline Mission& operator=(const Mission& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Mission(Mission&& from) noexcept
     : Mission() {
     *this = ::std::move(from);
   }
 
+  inline Mission& operator=(const Mission& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Mission& operator=(Mission&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Mission& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mission& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Mission* internal_default_instance() {
     return reinterpret_cast<const Mission*>(
                &_Mission_default_instance_);
@@ -931,51 +1303,71 @@ class Mission : public ::google::protobuf::Message /* @@protoc_insertion_point(c
   static constexpr int kIndexInFileMessages =
     6;
 
-  void Swap(Mission* other);
   friend void swap(Mission& a, Mission& b) {
     a.Swap(&b);
   }
+  inline void Swap(Mission* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mission* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Mission* New() const final {
-    return CreateMaybeMessage<Mission>(NULL);
-  }
-
-  Mission* New(::google::protobuf::Arena* arena) const final {
+  Mission* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Mission>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Mission& from);
-  void MergeFrom(const Mission& from);
-  void Clear() final;
-  bool IsInitialized() const final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Mission& from) {
+    Mission::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Mission* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pb.mission.Mission";
   }
+  protected:
+  explicit Mission(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -985,40 +1377,733 @@ class Mission : public ::google::protobuf::Message /* @@protoc_insertion_point(c
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kComponentsFieldNumber = 2,
+    kNameFieldNumber = 1,
+  };
   // repeated .pb.mission.Mission.Component components = 2;
   int components_size() const;
+  private:
+  int _internal_components_size() const;
+  public:
   void clear_components();
-  static const int kComponentsFieldNumber = 2;
   ::pb::mission::Mission_Component* mutable_components(int index);
-  ::google::protobuf::RepeatedPtrField< ::pb::mission::Mission_Component >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::Mission_Component >*
       mutable_components();
+  private:
+  const ::pb::mission::Mission_Component& _internal_components(int index) const;
+  ::pb::mission::Mission_Component* _internal_add_components();
+  public:
   const ::pb::mission::Mission_Component& components(int index) const;
   ::pb::mission::Mission_Component* add_components();
-  const ::google::protobuf::RepeatedPtrField< ::pb::mission::Mission_Component >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::Mission_Component >&
       components() const;
 
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:pb.mission.Mission)
  private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::Mission_Component > components_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mission_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MissionIndex_Component final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pb.mission.MissionIndex.Component) */ {
+ public:
+  inline MissionIndex_Component() : MissionIndex_Component(nullptr) {}
+  ~MissionIndex_Component() override;
+  explicit PROTOBUF_CONSTEXPR MissionIndex_Component(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MissionIndex_Component(const MissionIndex_Component& from);
+  MissionIndex_Component(MissionIndex_Component&& from) noexcept
+    : MissionIndex_Component() {
+    *this = ::std::move(from);
+  }
+
+  inline MissionIndex_Component& operator=(const MissionIndex_Component& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MissionIndex_Component& operator=(MissionIndex_Component&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MissionIndex_Component& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MissionIndex_Component* internal_default_instance() {
+    return reinterpret_cast<const MissionIndex_Component*>(
+               &_MissionIndex_Component_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(MissionIndex_Component& a, MissionIndex_Component& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MissionIndex_Component* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MissionIndex_Component* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MissionIndex_Component* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MissionIndex_Component>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MissionIndex_Component& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MissionIndex_Component& from) {
+    MissionIndex_Component::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MissionIndex_Component* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pb.mission.MissionIndex.Component";
+  }
+  protected:
+  explicit MissionIndex_Component(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kElementOffsetsFieldNumber = 4,
+    kElementSizesFieldNumber = 5,
+    kNameFieldNumber = 3,
+    kOffsetFieldNumber = 1,
+    kSizeFieldNumber = 2,
+  };
+  // repeated uint64 element_offsets = 4;
+  int element_offsets_size() const;
+  private:
+  int _internal_element_offsets_size() const;
+  public:
+  void clear_element_offsets();
+  private:
+  uint64_t _internal_element_offsets(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_element_offsets() const;
+  void _internal_add_element_offsets(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_element_offsets();
+  public:
+  uint64_t element_offsets(int index) const;
+  void set_element_offsets(int index, uint64_t value);
+  void add_element_offsets(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      element_offsets() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_element_offsets();
+
+  // repeated uint32 element_sizes = 5;
+  int element_sizes_size() const;
+  private:
+  int _internal_element_sizes_size() const;
+  public:
+  void clear_element_sizes();
+  private:
+  uint32_t _internal_element_sizes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_element_sizes() const;
+  void _internal_add_element_sizes(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_element_sizes();
+  public:
+  uint32_t element_sizes(int index) const;
+  void set_element_sizes(int index, uint32_t value);
+  void add_element_sizes(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      element_sizes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_element_sizes();
+
+  // string name = 3;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 offset = 1;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // uint32 size = 2;
+  void clear_size();
+  uint32_t size() const;
+  void set_size(uint32_t value);
+  private:
+  uint32_t _internal_size() const;
+  void _internal_set_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pb.mission.MissionIndex.Component)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > element_offsets_;
+    mutable std::atomic<int> _element_offsets_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > element_sizes_;
+    mutable std::atomic<int> _element_sizes_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t offset_;
+    uint32_t size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mission_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MissionIndex final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pb.mission.MissionIndex) */ {
+ public:
+  inline MissionIndex() : MissionIndex(nullptr) {}
+  ~MissionIndex() override;
+  explicit PROTOBUF_CONSTEXPR MissionIndex(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MissionIndex(const MissionIndex& from);
+  MissionIndex(MissionIndex&& from) noexcept
+    : MissionIndex() {
+    *this = ::std::move(from);
+  }
+
+  inline MissionIndex& operator=(const MissionIndex& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MissionIndex& operator=(MissionIndex&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MissionIndex& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MissionIndex* internal_default_instance() {
+    return reinterpret_cast<const MissionIndex*>(
+               &_MissionIndex_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::pb::mission::Mission_Component > components_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_mission_2eproto::TableStruct;
+  friend void swap(MissionIndex& a, MissionIndex& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MissionIndex* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MissionIndex* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MissionIndex* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MissionIndex>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MissionIndex& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MissionIndex& from) {
+    MissionIndex::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MissionIndex* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pb.mission.MissionIndex";
+  }
+  protected:
+  explicit MissionIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MissionIndex_Component Component;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kComponentsFieldNumber = 1,
+    kHeaderOffsetFieldNumber = 2,
+    kHeaderSizeFieldNumber = 3,
+  };
+  // repeated .pb.mission.MissionIndex.Component components = 1;
+  int components_size() const;
+  private:
+  int _internal_components_size() const;
+  public:
+  void clear_components();
+  ::pb::mission::MissionIndex_Component* mutable_components(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::MissionIndex_Component >*
+      mutable_components();
+  private:
+  const ::pb::mission::MissionIndex_Component& _internal_components(int index) const;
+  ::pb::mission::MissionIndex_Component* _internal_add_components();
+  public:
+  const ::pb::mission::MissionIndex_Component& components(int index) const;
+  ::pb::mission::MissionIndex_Component* add_components();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::MissionIndex_Component >&
+      components() const;
+
+  // uint64 header_offset = 2;
+  void clear_header_offset();
+  uint64_t header_offset() const;
+  void set_header_offset(uint64_t value);
+  private:
+  uint64_t _internal_header_offset() const;
+  void _internal_set_header_offset(uint64_t value);
+  public:
+
+  // uint32 header_size = 3;
+  void clear_header_size();
+  uint32_t header_size() const;
+  void set_header_size(uint32_t value);
+  private:
+  uint32_t _internal_header_size() const;
+  void _internal_set_header_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pb.mission.MissionIndex)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::MissionIndex_Component > components_;
+    uint64_t header_offset_;
+    uint32_t header_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mission_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MissionEdit final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:pb.mission.MissionEdit) */ {
+ public:
+  inline MissionEdit() : MissionEdit(nullptr) {}
+  ~MissionEdit() override;
+  explicit PROTOBUF_CONSTEXPR MissionEdit(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MissionEdit(const MissionEdit& from);
+  MissionEdit(MissionEdit&& from) noexcept
+    : MissionEdit() {
+    *this = ::std::move(from);
+  }
+
+  inline MissionEdit& operator=(const MissionEdit& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MissionEdit& operator=(MissionEdit&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MissionEdit& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MissionEdit* internal_default_instance() {
+    return reinterpret_cast<const MissionEdit*>(
+               &_MissionEdit_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(MissionEdit& a, MissionEdit& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MissionEdit* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MissionEdit* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MissionEdit* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MissionEdit>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MissionEdit& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MissionEdit& from) {
+    MissionEdit::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MissionEdit* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "pb.mission.MissionEdit";
+  }
+  protected:
+  explicit MissionEdit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MissionEdit_Type Type;
+  static constexpr Type kAddPoint =
+    MissionEdit_Type_kAddPoint;
+  static constexpr Type kAddRail =
+    MissionEdit_Type_kAddRail;
+  static constexpr Type kRemove =
+    MissionEdit_Type_kRemove;
+  static constexpr Type kInsert =
+    MissionEdit_Type_kInsert;
+  static inline bool Type_IsValid(int value) {
+    return MissionEdit_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    MissionEdit_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    MissionEdit_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    MissionEdit_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return MissionEdit_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return MissionEdit_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return MissionEdit_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kParentFieldNumber = 2,
+    kMessagesFieldNumber = 6,
+    kNameFieldNumber = 5,
+    kTypeFieldNumber = 1,
+    kRowFieldNumber = 3,
+    kCountFieldNumber = 4,
+  };
+  // repeated uint32 parent = 2;
+  int parent_size() const;
+  private:
+  int _internal_parent_size() const;
+  public:
+  void clear_parent();
+  private:
+  uint32_t _internal_parent(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_parent() const;
+  void _internal_add_parent(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_parent();
+  public:
+  uint32_t parent(int index) const;
+  void set_parent(int index, uint32_t value);
+  void add_parent(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      parent() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_parent();
+
+  // repeated bytes messages = 6;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  const std::string& messages(int index) const;
+  std::string* mutable_messages(int index);
+  void set_messages(int index, const std::string& value);
+  void set_messages(int index, std::string&& value);
+  void set_messages(int index, const char* value);
+  void set_messages(int index, const void* value, size_t size);
+  std::string* add_messages();
+  void add_messages(const std::string& value);
+  void add_messages(std::string&& value);
+  void add_messages(const char* value);
+  void add_messages(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& messages() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_messages();
+  private:
+  const std::string& _internal_messages(int index) const;
+  std::string* _internal_add_messages();
+  public:
+
+  // string name = 5;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // .pb.mission.MissionEdit.Type type = 1;
+  void clear_type();
+  ::pb::mission::MissionEdit_Type type() const;
+  void set_type(::pb::mission::MissionEdit_Type value);
+  private:
+  ::pb::mission::MissionEdit_Type _internal_type() const;
+  void _internal_set_type(::pb::mission::MissionEdit_Type value);
+  public:
+
+  // uint32 row = 3;
+  void clear_row();
+  uint32_t row() const;
+  void set_row(uint32_t value);
+  private:
+  uint32_t _internal_row() const;
+  void _internal_set_row(uint32_t value);
+  public:
+
+  // uint32 count = 4;
+  void clear_count();
+  uint32_t count() const;
+  void set_count(uint32_t value);
+  private:
+  uint32_t _internal_count() const;
+  void _internal_set_count(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:pb.mission.MissionEdit)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > parent_;
+    mutable std::atomic<int> _parent_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> messages_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int type_;
+    uint32_t row_;
+    uint32_t count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mission_2eproto;
 };
 // ===================================================================
 
@@ -1033,54 +2118,51 @@ class Mission : public ::google::protobuf::Message /* @@protoc_insertion_point(c
 
 // string name = 1;
 inline void Mission_Element_Point::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& Mission_Element_Point::name() const {
+inline const std::string& Mission_Element_Point::name() const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Element.Point.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void Mission_Element_Point::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Mission_Element_Point::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:pb.mission.Mission.Element.Point.name)
 }
-#if LANG_CXX11
-inline void Mission_Element_Point::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:pb.mission.Mission.Element.Point.name)
+inline std::string* Mission_Element_Point::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.Point.name)
+  return _s;
 }
-#endif
-inline void Mission_Element_Point::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:pb.mission.Mission.Element.Point.name)
+inline const std::string& Mission_Element_Point::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Mission_Element_Point::set_name(const char* value, size_t size) {
+inline void Mission_Element_Point::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:pb.mission.Mission.Element.Point.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Mission_Element_Point::mutable_name() {
+inline std::string* Mission_Element_Point::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.Point.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Mission_Element_Point::release_name() {
+inline std::string* Mission_Element_Point::release_name() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Element.Point.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void Mission_Element_Point::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void Mission_Element_Point::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Element.Point.name)
 }
 
@@ -1090,162 +2172,231 @@ inline void Mission_Element_Point::set_allocated_name(::std::string* name) {
 
 // string name = 1;
 inline void Mission_Element_Rail::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& Mission_Element_Rail::name() const {
+inline const std::string& Mission_Element_Rail::name() const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Element.Rail.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void Mission_Element_Rail::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Mission_Element_Rail::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:pb.mission.Mission.Element.Rail.name)
 }
-#if LANG_CXX11
-inline void Mission_Element_Rail::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:pb.mission.Mission.Element.Rail.name)
+inline std::string* Mission_Element_Rail::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.Rail.name)
+  return _s;
 }
-#endif
-inline void Mission_Element_Rail::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:pb.mission.Mission.Element.Rail.name)
+inline const std::string& Mission_Element_Rail::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Mission_Element_Rail::set_name(const char* value, size_t size) {
+inline void Mission_Element_Rail::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:pb.mission.Mission.Element.Rail.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Mission_Element_Rail::mutable_name() {
+inline std::string* Mission_Element_Rail::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.Rail.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Mission_Element_Rail::release_name() {
+inline std::string* Mission_Element_Rail::release_name() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Element.Rail.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void Mission_Element_Rail::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void Mission_Element_Rail::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Element.Rail.name)
 }
 
 // .pb.mission.Mission.Element.Point p0 = 2;
+inline bool Mission_Element_Rail::_internal_has_p0() const {
+  return this != internal_default_instance() && _impl_.p0_ != nullptr;
+}
 inline bool Mission_Element_Rail::has_p0() const {
-  return this != internal_default_instance() && p0_ != NULL;
+  return _internal_has_p0();
 }
 inline void Mission_Element_Rail::clear_p0() {
-  if (GetArenaNoVirtual() == NULL && p0_ != NULL) {
-    delete p0_;
+  if (GetArenaForAllocation() == nullptr && _impl_.p0_ != nullptr) {
+    delete _impl_.p0_;
   }
-  p0_ = NULL;
+  _impl_.p0_ = nullptr;
 }
 inline const ::pb::mission::Mission_Element_Point& Mission_Element_Rail::_internal_p0() const {
-  return *p0_;
+  const ::pb::mission::Mission_Element_Point* p = _impl_.p0_;
+  return p != nullptr ? *p : reinterpret_cast<const ::pb::mission::Mission_Element_Point&>(
+      ::pb::mission::_Mission_Element_Point_default_instance_);
 }
 inline const ::pb::mission::Mission_Element_Point& Mission_Element_Rail::p0() const {
-  const ::pb::mission::Mission_Element_Point* p = p0_;
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Element.Rail.p0)
-  return p != NULL ? *p : *reinterpret_cast<const ::pb::mission::Mission_Element_Point*>(
-      &::pb::mission::_Mission_Element_Point_default_instance_);
+  return _internal_p0();
+}
+inline void Mission_Element_Rail::unsafe_arena_set_allocated_p0(
+    ::pb::mission::Mission_Element_Point* p0) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.p0_);
+  }
+  _impl_.p0_ = p0;
+  if (p0) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:pb.mission.Mission.Element.Rail.p0)
 }
 inline ::pb::mission::Mission_Element_Point* Mission_Element_Rail::release_p0() {
+  
+  ::pb::mission::Mission_Element_Point* temp = _impl_.p0_;
+  _impl_.p0_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Rail::unsafe_arena_release_p0() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Element.Rail.p0)
   
-  ::pb::mission::Mission_Element_Point* temp = p0_;
-  p0_ = NULL;
+  ::pb::mission::Mission_Element_Point* temp = _impl_.p0_;
+  _impl_.p0_ = nullptr;
   return temp;
 }
-inline ::pb::mission::Mission_Element_Point* Mission_Element_Rail::mutable_p0() {
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Rail::_internal_mutable_p0() {
   
-  if (p0_ == NULL) {
-    auto* p = CreateMaybeMessage<::pb::mission::Mission_Element_Point>(GetArenaNoVirtual());
-    p0_ = p;
+  if (_impl_.p0_ == nullptr) {
+    auto* p = CreateMaybeMessage<::pb::mission::Mission_Element_Point>(GetArenaForAllocation());
+    _impl_.p0_ = p;
   }
+  return _impl_.p0_;
+}
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Rail::mutable_p0() {
+  ::pb::mission::Mission_Element_Point* _msg = _internal_mutable_p0();
   // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.Rail.p0)
-  return p0_;
+  return _msg;
 }
 inline void Mission_Element_Rail::set_allocated_p0(::pb::mission::Mission_Element_Point* p0) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete p0_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.p0_;
   }
   if (p0) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(p0);
     if (message_arena != submessage_arena) {
-      p0 = ::google::protobuf::internal::GetOwnedMessage(
+      p0 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, p0, submessage_arena);
     }
     
   } else {
     
   }
-  p0_ = p0;
+  _impl_.p0_ = p0;
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Element.Rail.p0)
 }
 
 // .pb.mission.Mission.Element.Point p1 = 3;
+inline bool Mission_Element_Rail::_internal_has_p1() const {
+  return this != internal_default_instance() && _impl_.p1_ != nullptr;
+}
 inline bool Mission_Element_Rail::has_p1() const {
-  return this != internal_default_instance() && p1_ != NULL;
+  return _internal_has_p1();
 }
 inline void Mission_Element_Rail::clear_p1() {
-  if (GetArenaNoVirtual() == NULL && p1_ != NULL) {
-    delete p1_;
+  if (GetArenaForAllocation() == nullptr && _impl_.p1_ != nullptr) {
+    delete _impl_.p1_;
   }
-  p1_ = NULL;
+  _impl_.p1_ = nullptr;
 }
 inline const ::pb::mission::Mission_Element_Point& Mission_Element_Rail::_internal_p1() const {
-  return *p1_;
+  const ::pb::mission::Mission_Element_Point* p = _impl_.p1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::pb::mission::Mission_Element_Point&>(
+      ::pb::mission::_Mission_Element_Point_default_instance_);
 }
 inline const ::pb::mission::Mission_Element_Point& Mission_Element_Rail::p1() const {
-  const ::pb::mission::Mission_Element_Point* p = p1_;
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Element.Rail.p1)
-  return p != NULL ? *p : *reinterpret_cast<const ::pb::mission::Mission_Element_Point*>(
-      &::pb::mission::_Mission_Element_Point_default_instance_);
+  return _internal_p1();
+}
+inline void Mission_Element_Rail::unsafe_arena_set_allocated_p1(
+    ::pb::mission::Mission_Element_Point* p1) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.p1_);
+  }
+  _impl_.p1_ = p1;
+  if (p1) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:pb.mission.Mission.Element.Rail.p1)
 }
 inline ::pb::mission::Mission_Element_Point* Mission_Element_Rail::release_p1() {
+  
+  ::pb::mission::Mission_Element_Point* temp = _impl_.p1_;
+  _impl_.p1_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Rail::unsafe_arena_release_p1() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Element.Rail.p1)
   
-  ::pb::mission::Mission_Element_Point* temp = p1_;
-  p1_ = NULL;
+  ::pb::mission::Mission_Element_Point* temp = _impl_.p1_;
+  _impl_.p1_ = nullptr;
   return temp;
 }
-inline ::pb::mission::Mission_Element_Point* Mission_Element_Rail::mutable_p1() {
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Rail::_internal_mutable_p1() {
   
-  if (p1_ == NULL) {
-    auto* p = CreateMaybeMessage<::pb::mission::Mission_Element_Point>(GetArenaNoVirtual());
-    p1_ = p;
+  if (_impl_.p1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::pb::mission::Mission_Element_Point>(GetArenaForAllocation());
+    _impl_.p1_ = p;
   }
+  return _impl_.p1_;
+}
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Rail::mutable_p1() {
+  ::pb::mission::Mission_Element_Point* _msg = _internal_mutable_p1();
   // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.Rail.p1)
-  return p1_;
+  return _msg;
 }
 inline void Mission_Element_Rail::set_allocated_p1(::pb::mission::Mission_Element_Point* p1) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete p1_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.p1_;
   }
   if (p1) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(p1);
     if (message_arena != submessage_arena) {
-      p1 = ::google::protobuf::internal::GetOwnedMessage(
+      p1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, p1, submessage_arena);
     }
     
   } else {
     
   }
-  p1_ = p1;
+  _impl_.p1_ = p1;
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Element.Rail.p1)
 }
 
@@ -1255,162 +2406,231 @@ inline void Mission_Element_Rail::set_allocated_p1(::pb::mission::Mission_Elemen
 
 // string name = 1;
 inline void Mission_Element_Segment::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& Mission_Element_Segment::name() const {
+inline const std::string& Mission_Element_Segment::name() const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Element.Segment.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void Mission_Element_Segment::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Mission_Element_Segment::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:pb.mission.Mission.Element.Segment.name)
 }
-#if LANG_CXX11
-inline void Mission_Element_Segment::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:pb.mission.Mission.Element.Segment.name)
+inline std::string* Mission_Element_Segment::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.Segment.name)
+  return _s;
 }
-#endif
-inline void Mission_Element_Segment::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:pb.mission.Mission.Element.Segment.name)
+inline const std::string& Mission_Element_Segment::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Mission_Element_Segment::set_name(const char* value, size_t size) {
+inline void Mission_Element_Segment::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:pb.mission.Mission.Element.Segment.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Mission_Element_Segment::mutable_name() {
+inline std::string* Mission_Element_Segment::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.Segment.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Mission_Element_Segment::release_name() {
+inline std::string* Mission_Element_Segment::release_name() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Element.Segment.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void Mission_Element_Segment::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void Mission_Element_Segment::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Element.Segment.name)
 }
 
 // .pb.mission.Mission.Element.Point p0 = 2;
+inline bool Mission_Element_Segment::_internal_has_p0() const {
+  return this != internal_default_instance() && _impl_.p0_ != nullptr;
+}
 inline bool Mission_Element_Segment::has_p0() const {
-  return this != internal_default_instance() && p0_ != NULL;
+  return _internal_has_p0();
 }
 inline void Mission_Element_Segment::clear_p0() {
-  if (GetArenaNoVirtual() == NULL && p0_ != NULL) {
-    delete p0_;
+  if (GetArenaForAllocation() == nullptr && _impl_.p0_ != nullptr) {
+    delete _impl_.p0_;
   }
-  p0_ = NULL;
+  _impl_.p0_ = nullptr;
 }
 inline const ::pb::mission::Mission_Element_Point& Mission_Element_Segment::_internal_p0() const {
-  return *p0_;
+  const ::pb::mission::Mission_Element_Point* p = _impl_.p0_;
+  return p != nullptr ? *p : reinterpret_cast<const ::pb::mission::Mission_Element_Point&>(
+      ::pb::mission::_Mission_Element_Point_default_instance_);
 }
 inline const ::pb::mission::Mission_Element_Point& Mission_Element_Segment::p0() const {
-  const ::pb::mission::Mission_Element_Point* p = p0_;
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Element.Segment.p0)
-  return p != NULL ? *p : *reinterpret_cast<const ::pb::mission::Mission_Element_Point*>(
-      &::pb::mission::_Mission_Element_Point_default_instance_);
+  return _internal_p0();
+}
+inline void Mission_Element_Segment::unsafe_arena_set_allocated_p0(
+    ::pb::mission::Mission_Element_Point* p0) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.p0_);
+  }
+  _impl_.p0_ = p0;
+  if (p0) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:pb.mission.Mission.Element.Segment.p0)
 }
 inline ::pb::mission::Mission_Element_Point* Mission_Element_Segment::release_p0() {
+  
+  ::pb::mission::Mission_Element_Point* temp = _impl_.p0_;
+  _impl_.p0_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Segment::unsafe_arena_release_p0() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Element.Segment.p0)
   
-  ::pb::mission::Mission_Element_Point* temp = p0_;
-  p0_ = NULL;
+  ::pb::mission::Mission_Element_Point* temp = _impl_.p0_;
+  _impl_.p0_ = nullptr;
   return temp;
 }
-inline ::pb::mission::Mission_Element_Point* Mission_Element_Segment::mutable_p0() {
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Segment::_internal_mutable_p0() {
   
-  if (p0_ == NULL) {
-    auto* p = CreateMaybeMessage<::pb::mission::Mission_Element_Point>(GetArenaNoVirtual());
-    p0_ = p;
+  if (_impl_.p0_ == nullptr) {
+    auto* p = CreateMaybeMessage<::pb::mission::Mission_Element_Point>(GetArenaForAllocation());
+    _impl_.p0_ = p;
   }
+  return _impl_.p0_;
+}
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Segment::mutable_p0() {
+  ::pb::mission::Mission_Element_Point* _msg = _internal_mutable_p0();
   // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.Segment.p0)
-  return p0_;
+  return _msg;
 }
 inline void Mission_Element_Segment::set_allocated_p0(::pb::mission::Mission_Element_Point* p0) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete p0_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.p0_;
   }
   if (p0) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(p0);
     if (message_arena != submessage_arena) {
-      p0 = ::google::protobuf::internal::GetOwnedMessage(
+      p0 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, p0, submessage_arena);
     }
     
   } else {
     
   }
-  p0_ = p0;
+  _impl_.p0_ = p0;
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Element.Segment.p0)
 }
 
 // .pb.mission.Mission.Element.Point p1 = 3;
+inline bool Mission_Element_Segment::_internal_has_p1() const {
+  return this != internal_default_instance() && _impl_.p1_ != nullptr;
+}
 inline bool Mission_Element_Segment::has_p1() const {
-  return this != internal_default_instance() && p1_ != NULL;
+  return _internal_has_p1();
 }
 inline void Mission_Element_Segment::clear_p1() {
-  if (GetArenaNoVirtual() == NULL && p1_ != NULL) {
-    delete p1_;
+  if (GetArenaForAllocation() == nullptr && _impl_.p1_ != nullptr) {
+    delete _impl_.p1_;
   }
-  p1_ = NULL;
+  _impl_.p1_ = nullptr;
 }
 inline const ::pb::mission::Mission_Element_Point& Mission_Element_Segment::_internal_p1() const {
-  return *p1_;
+  const ::pb::mission::Mission_Element_Point* p = _impl_.p1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::pb::mission::Mission_Element_Point&>(
+      ::pb::mission::_Mission_Element_Point_default_instance_);
 }
 inline const ::pb::mission::Mission_Element_Point& Mission_Element_Segment::p1() const {
-  const ::pb::mission::Mission_Element_Point* p = p1_;
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Element.Segment.p1)
-  return p != NULL ? *p : *reinterpret_cast<const ::pb::mission::Mission_Element_Point*>(
-      &::pb::mission::_Mission_Element_Point_default_instance_);
+  return _internal_p1();
+}
+inline void Mission_Element_Segment::unsafe_arena_set_allocated_p1(
+    ::pb::mission::Mission_Element_Point* p1) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.p1_);
+  }
+  _impl_.p1_ = p1;
+  if (p1) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:pb.mission.Mission.Element.Segment.p1)
 }
 inline ::pb::mission::Mission_Element_Point* Mission_Element_Segment::release_p1() {
+  
+  ::pb::mission::Mission_Element_Point* temp = _impl_.p1_;
+  _impl_.p1_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Segment::unsafe_arena_release_p1() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Element.Segment.p1)
   
-  ::pb::mission::Mission_Element_Point* temp = p1_;
-  p1_ = NULL;
+  ::pb::mission::Mission_Element_Point* temp = _impl_.p1_;
+  _impl_.p1_ = nullptr;
   return temp;
 }
-inline ::pb::mission::Mission_Element_Point* Mission_Element_Segment::mutable_p1() {
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Segment::_internal_mutable_p1() {
   
-  if (p1_ == NULL) {
-    auto* p = CreateMaybeMessage<::pb::mission::Mission_Element_Point>(GetArenaNoVirtual());
-    p1_ = p;
+  if (_impl_.p1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::pb::mission::Mission_Element_Point>(GetArenaForAllocation());
+    _impl_.p1_ = p;
   }
+  return _impl_.p1_;
+}
+inline ::pb::mission::Mission_Element_Point* Mission_Element_Segment::mutable_p1() {
+  ::pb::mission::Mission_Element_Point* _msg = _internal_mutable_p1();
   // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.Segment.p1)
-  return p1_;
+  return _msg;
 }
 inline void Mission_Element_Segment::set_allocated_p1(::pb::mission::Mission_Element_Point* p1) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete p1_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.p1_;
   }
   if (p1) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(p1);
     if (message_arena != submessage_arena) {
-      p1 = ::google::protobuf::internal::GetOwnedMessage(
+      p1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, p1, submessage_arena);
     }
     
   } else {
     
   }
-  p1_ = p1;
+  _impl_.p1_ = p1;
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Element.Segment.p1)
 }
 
@@ -1419,145 +2639,235 @@ inline void Mission_Element_Segment::set_allocated_p1(::pb::mission::Mission_Ele
 // Mission_Element
 
 // .pb.mission.Mission.Element.Point point = 1;
-inline bool Mission_Element::has_point() const {
+inline bool Mission_Element::_internal_has_point() const {
   return element_case() == kPoint;
 }
+inline bool Mission_Element::has_point() const {
+  return _internal_has_point();
+}
 inline void Mission_Element::set_has_point() {
-  _oneof_case_[0] = kPoint;
+  _impl_._oneof_case_[0] = kPoint;
 }
 inline void Mission_Element::clear_point() {
-  if (has_point()) {
-    delete element_.point_;
+  if (_internal_has_point()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.element_.point_;
+    }
     clear_has_element();
   }
 }
-inline const ::pb::mission::Mission_Element_Point& Mission_Element::_internal_point() const {
-  return *element_.point_;
-}
 inline ::pb::mission::Mission_Element_Point* Mission_Element::release_point() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Element.point)
-  if (has_point()) {
+  if (_internal_has_point()) {
     clear_has_element();
-      ::pb::mission::Mission_Element_Point* temp = element_.point_;
-    element_.point_ = NULL;
+    ::pb::mission::Mission_Element_Point* temp = _impl_.element_.point_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.element_.point_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::pb::mission::Mission_Element_Point& Mission_Element::_internal_point() const {
+  return _internal_has_point()
+      ? *_impl_.element_.point_
+      : reinterpret_cast< ::pb::mission::Mission_Element_Point&>(::pb::mission::_Mission_Element_Point_default_instance_);
+}
 inline const ::pb::mission::Mission_Element_Point& Mission_Element::point() const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Element.point)
-  return has_point()
-      ? *element_.point_
-      : *reinterpret_cast< ::pb::mission::Mission_Element_Point*>(&::pb::mission::_Mission_Element_Point_default_instance_);
+  return _internal_point();
 }
-inline ::pb::mission::Mission_Element_Point* Mission_Element::mutable_point() {
-  if (!has_point()) {
+inline ::pb::mission::Mission_Element_Point* Mission_Element::unsafe_arena_release_point() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:pb.mission.Mission.Element.point)
+  if (_internal_has_point()) {
+    clear_has_element();
+    ::pb::mission::Mission_Element_Point* temp = _impl_.element_.point_;
+    _impl_.element_.point_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Mission_Element::unsafe_arena_set_allocated_point(::pb::mission::Mission_Element_Point* point) {
+  clear_element();
+  if (point) {
+    set_has_point();
+    _impl_.element_.point_ = point;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:pb.mission.Mission.Element.point)
+}
+inline ::pb::mission::Mission_Element_Point* Mission_Element::_internal_mutable_point() {
+  if (!_internal_has_point()) {
     clear_element();
     set_has_point();
-    element_.point_ = CreateMaybeMessage< ::pb::mission::Mission_Element_Point >(
-        GetArenaNoVirtual());
+    _impl_.element_.point_ = CreateMaybeMessage< ::pb::mission::Mission_Element_Point >(GetArenaForAllocation());
   }
+  return _impl_.element_.point_;
+}
+inline ::pb::mission::Mission_Element_Point* Mission_Element::mutable_point() {
+  ::pb::mission::Mission_Element_Point* _msg = _internal_mutable_point();
   // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.point)
-  return element_.point_;
+  return _msg;
 }
 
 // .pb.mission.Mission.Element.Rail rail = 2;
-inline bool Mission_Element::has_rail() const {
+inline bool Mission_Element::_internal_has_rail() const {
   return element_case() == kRail;
 }
+inline bool Mission_Element::has_rail() const {
+  return _internal_has_rail();
+}
 inline void Mission_Element::set_has_rail() {
-  _oneof_case_[0] = kRail;
+  _impl_._oneof_case_[0] = kRail;
 }
 inline void Mission_Element::clear_rail() {
-  if (has_rail()) {
-    delete element_.rail_;
+  if (_internal_has_rail()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.element_.rail_;
+    }
     clear_has_element();
   }
 }
-inline const ::pb::mission::Mission_Element_Rail& Mission_Element::_internal_rail() const {
-  return *element_.rail_;
-}
 inline ::pb::mission::Mission_Element_Rail* Mission_Element::release_rail() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Element.rail)
-  if (has_rail()) {
+  if (_internal_has_rail()) {
     clear_has_element();
-      ::pb::mission::Mission_Element_Rail* temp = element_.rail_;
-    element_.rail_ = NULL;
+    ::pb::mission::Mission_Element_Rail* temp = _impl_.element_.rail_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.element_.rail_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::pb::mission::Mission_Element_Rail& Mission_Element::_internal_rail() const {
+  return _internal_has_rail()
+      ? *_impl_.element_.rail_
+      : reinterpret_cast< ::pb::mission::Mission_Element_Rail&>(::pb::mission::_Mission_Element_Rail_default_instance_);
+}
 inline const ::pb::mission::Mission_Element_Rail& Mission_Element::rail() const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Element.rail)
-  return has_rail()
-      ? *element_.rail_
-      : *reinterpret_cast< ::pb::mission::Mission_Element_Rail*>(&::pb::mission::_Mission_Element_Rail_default_instance_);
+  return _internal_rail();
+}
+inline ::pb::mission::Mission_Element_Rail* Mission_Element::unsafe_arena_release_rail() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:pb.mission.Mission.Element.rail)
+  if (_internal_has_rail()) {
+    clear_has_element();
+    ::pb::mission::Mission_Element_Rail* temp = _impl_.element_.rail_;
+    _impl_.element_.rail_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Mission_Element::unsafe_arena_set_allocated_rail(::pb::mission::Mission_Element_Rail* rail) {
+  clear_element();
+  if (rail) {
+    set_has_rail();
+    _impl_.element_.rail_ = rail;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:pb.mission.Mission.Element.rail)
 }
-inline ::pb::mission::Mission_Element_Rail* Mission_Element::mutable_rail() {
-  if (!has_rail()) {
+inline ::pb::mission::Mission_Element_Rail* Mission_Element::_internal_mutable_rail() {
+  if (!_internal_has_rail()) {
     clear_element();
     set_has_rail();
-    element_.rail_ = CreateMaybeMessage< ::pb::mission::Mission_Element_Rail >(
-        GetArenaNoVirtual());
+    _impl_.element_.rail_ = CreateMaybeMessage< ::pb::mission::Mission_Element_Rail >(GetArenaForAllocation());
   }
+  return _impl_.element_.rail_;
+}
+inline ::pb::mission::Mission_Element_Rail* Mission_Element::mutable_rail() {
+  ::pb::mission::Mission_Element_Rail* _msg = _internal_mutable_rail();
   // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.rail)
-  return element_.rail_;
+  return _msg;
 }
 
 // .pb.mission.Mission.Element.Segment segment = 3;
-inline bool Mission_Element::has_segment() const {
+inline bool Mission_Element::_internal_has_segment() const {
   return element_case() == kSegment;
 }
+inline bool Mission_Element::has_segment() const {
+  return _internal_has_segment();
+}
 inline void Mission_Element::set_has_segment() {
-  _oneof_case_[0] = kSegment;
+  _impl_._oneof_case_[0] = kSegment;
 }
 inline void Mission_Element::clear_segment() {
-  if (has_segment()) {
-    delete element_.segment_;
+  if (_internal_has_segment()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.element_.segment_;
+    }
     clear_has_element();
   }
 }
-inline const ::pb::mission::Mission_Element_Segment& Mission_Element::_internal_segment() const {
-  return *element_.segment_;
-}
 inline ::pb::mission::Mission_Element_Segment* Mission_Element::release_segment() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Element.segment)
-  if (has_segment()) {
+  if (_internal_has_segment()) {
     clear_has_element();
-      ::pb::mission::Mission_Element_Segment* temp = element_.segment_;
-    element_.segment_ = NULL;
+    ::pb::mission::Mission_Element_Segment* temp = _impl_.element_.segment_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.element_.segment_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::pb::mission::Mission_Element_Segment& Mission_Element::_internal_segment() const {
+  return _internal_has_segment()
+      ? *_impl_.element_.segment_
+      : reinterpret_cast< ::pb::mission::Mission_Element_Segment&>(::pb::mission::_Mission_Element_Segment_default_instance_);
+}
 inline const ::pb::mission::Mission_Element_Segment& Mission_Element::segment() const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Element.segment)
-  return has_segment()
-      ? *element_.segment_
-      : *reinterpret_cast< ::pb::mission::Mission_Element_Segment*>(&::pb::mission::_Mission_Element_Segment_default_instance_);
+  return _internal_segment();
 }
-inline ::pb::mission::Mission_Element_Segment* Mission_Element::mutable_segment() {
-  if (!has_segment()) {
+inline ::pb::mission::Mission_Element_Segment* Mission_Element::unsafe_arena_release_segment() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:pb.mission.Mission.Element.segment)
+  if (_internal_has_segment()) {
+    clear_has_element();
+    ::pb::mission::Mission_Element_Segment* temp = _impl_.element_.segment_;
+    _impl_.element_.segment_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Mission_Element::unsafe_arena_set_allocated_segment(::pb::mission::Mission_Element_Segment* segment) {
+  clear_element();
+  if (segment) {
+    set_has_segment();
+    _impl_.element_.segment_ = segment;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:pb.mission.Mission.Element.segment)
+}
+inline ::pb::mission::Mission_Element_Segment* Mission_Element::_internal_mutable_segment() {
+  if (!_internal_has_segment()) {
     clear_element();
     set_has_segment();
-    element_.segment_ = CreateMaybeMessage< ::pb::mission::Mission_Element_Segment >(
-        GetArenaNoVirtual());
+    _impl_.element_.segment_ = CreateMaybeMessage< ::pb::mission::Mission_Element_Segment >(GetArenaForAllocation());
   }
+  return _impl_.element_.segment_;
+}
+inline ::pb::mission::Mission_Element_Segment* Mission_Element::mutable_segment() {
+  ::pb::mission::Mission_Element_Segment* _msg = _internal_mutable_segment();
   // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Element.segment)
-  return element_.segment_;
+  return _msg;
 }
 
 inline bool Mission_Element::has_element() const {
   return element_case() != ELEMENT_NOT_SET;
 }
 inline void Mission_Element::clear_has_element() {
-  _oneof_case_[0] = ELEMENT_NOT_SET;
+  _impl_._oneof_case_[0] = ELEMENT_NOT_SET;
 }
 inline Mission_Element::ElementCase Mission_Element::element_case() const {
-  return Mission_Element::ElementCase(_oneof_case_[0]);
+  return Mission_Element::ElementCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -1565,85 +2875,92 @@ inline Mission_Element::ElementCase Mission_Element::element_case() const {
 
 // string name = 1;
 inline void Mission_Collection::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& Mission_Collection::name() const {
+inline const std::string& Mission_Collection::name() const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Collection.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void Mission_Collection::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Mission_Collection::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:pb.mission.Mission.Collection.name)
 }
-#if LANG_CXX11
-inline void Mission_Collection::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:pb.mission.Mission.Collection.name)
+inline std::string* Mission_Collection::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Collection.name)
+  return _s;
 }
-#endif
-inline void Mission_Collection::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:pb.mission.Mission.Collection.name)
+inline const std::string& Mission_Collection::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Mission_Collection::set_name(const char* value, size_t size) {
+inline void Mission_Collection::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:pb.mission.Mission.Collection.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Mission_Collection::mutable_name() {
+inline std::string* Mission_Collection::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Collection.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Mission_Collection::release_name() {
+inline std::string* Mission_Collection::release_name() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Collection.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void Mission_Collection::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void Mission_Collection::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.Collection.name)
 }
 
 // repeated .pb.mission.Mission.Element elements = 2;
+inline int Mission_Collection::_internal_elements_size() const {
+  return _impl_.elements_.size();
+}
 inline int Mission_Collection::elements_size() const {
-  return elements_.size();
+  return _internal_elements_size();
 }
 inline void Mission_Collection::clear_elements() {
-  elements_.Clear();
+  _impl_.elements_.Clear();
 }
 inline ::pb::mission::Mission_Element* Mission_Collection::mutable_elements(int index) {
   // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Collection.elements)
-  return elements_.Mutable(index);
+  return _impl_.elements_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::pb::mission::Mission_Element >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::Mission_Element >*
 Mission_Collection::mutable_elements() {
   // @@protoc_insertion_point(field_mutable_list:pb.mission.Mission.Collection.elements)
-  return &elements_;
+  return &_impl_.elements_;
+}
+inline const ::pb::mission::Mission_Element& Mission_Collection::_internal_elements(int index) const {
+  return _impl_.elements_.Get(index);
 }
 inline const ::pb::mission::Mission_Element& Mission_Collection::elements(int index) const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Collection.elements)
-  return elements_.Get(index);
+  return _internal_elements(index);
+}
+inline ::pb::mission::Mission_Element* Mission_Collection::_internal_add_elements() {
+  return _impl_.elements_.Add();
 }
 inline ::pb::mission::Mission_Element* Mission_Collection::add_elements() {
+  ::pb::mission::Mission_Element* _add = _internal_add_elements();
   // @@protoc_insertion_point(field_add:pb.mission.Mission.Collection.elements)
-  return elements_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::pb::mission::Mission_Element >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::Mission_Element >&
 Mission_Collection::elements() const {
   // @@protoc_insertion_point(field_list:pb.mission.Mission.Collection.elements)
-  return elements_;
+  return _impl_.elements_;
 }
 
 // -------------------------------------------------------------------
@@ -1651,101 +2968,161 @@ Mission_Collection::elements() const {
 // Mission_Component
 
 // .pb.mission.Mission.Element element = 1;
-inline bool Mission_Component::has_element() const {
+inline bool Mission_Component::_internal_has_element() const {
   return component_case() == kElement;
 }
+inline bool Mission_Component::has_element() const {
+  return _internal_has_element();
+}
 inline void Mission_Component::set_has_element() {
-  _oneof_case_[0] = kElement;
+  _impl_._oneof_case_[0] = kElement;
 }
 inline void Mission_Component::clear_element() {
-  if (has_element()) {
-    delete component_.element_;
+  if (_internal_has_element()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.component_.element_;
+    }
     clear_has_component();
   }
 }
-inline const ::pb::mission::Mission_Element& Mission_Component::_internal_element() const {
-  return *component_.element_;
-}
 inline ::pb::mission::Mission_Element* Mission_Component::release_element() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Component.element)
-  if (has_element()) {
+  if (_internal_has_element()) {
     clear_has_component();
-      ::pb::mission::Mission_Element* temp = component_.element_;
-    component_.element_ = NULL;
+    ::pb::mission::Mission_Element* temp = _impl_.component_.element_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.component_.element_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::pb::mission::Mission_Element& Mission_Component::_internal_element() const {
+  return _internal_has_element()
+      ? *_impl_.component_.element_
+      : reinterpret_cast< ::pb::mission::Mission_Element&>(::pb::mission::_Mission_Element_default_instance_);
+}
 inline const ::pb::mission::Mission_Element& Mission_Component::element() const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Component.element)
-  return has_element()
-      ? *component_.element_
-      : *reinterpret_cast< ::pb::mission::Mission_Element*>(&::pb::mission::_Mission_Element_default_instance_);
+  return _internal_element();
 }
-inline ::pb::mission::Mission_Element* Mission_Component::mutable_element() {
-  if (!has_element()) {
+inline ::pb::mission::Mission_Element* Mission_Component::unsafe_arena_release_element() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:pb.mission.Mission.Component.element)
+  if (_internal_has_element()) {
+    clear_has_component();
+    ::pb::mission::Mission_Element* temp = _impl_.component_.element_;
+    _impl_.component_.element_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Mission_Component::unsafe_arena_set_allocated_element(::pb::mission::Mission_Element* element) {
+  clear_component();
+  if (element) {
+    set_has_element();
+    _impl_.component_.element_ = element;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:pb.mission.Mission.Component.element)
+}
+inline ::pb::mission::Mission_Element* Mission_Component::_internal_mutable_element() {
+  if (!_internal_has_element()) {
     clear_component();
     set_has_element();
-    component_.element_ = CreateMaybeMessage< ::pb::mission::Mission_Element >(
-        GetArenaNoVirtual());
+    _impl_.component_.element_ = CreateMaybeMessage< ::pb::mission::Mission_Element >(GetArenaForAllocation());
   }
+  return _impl_.component_.element_;
+}
+inline ::pb::mission::Mission_Element* Mission_Component::mutable_element() {
+  ::pb::mission::Mission_Element* _msg = _internal_mutable_element();
   // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Component.element)
-  return component_.element_;
+  return _msg;
 }
 
 // .pb.mission.Mission.Collection collection = 2;
-inline bool Mission_Component::has_collection() const {
+inline bool Mission_Component::_internal_has_collection() const {
   return component_case() == kCollection;
 }
+inline bool Mission_Component::has_collection() const {
+  return _internal_has_collection();
+}
 inline void Mission_Component::set_has_collection() {
-  _oneof_case_[0] = kCollection;
+  _impl_._oneof_case_[0] = kCollection;
 }
 inline void Mission_Component::clear_collection() {
-  if (has_collection()) {
-    delete component_.collection_;
+  if (_internal_has_collection()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.component_.collection_;
+    }
     clear_has_component();
   }
 }
-inline const ::pb::mission::Mission_Collection& Mission_Component::_internal_collection() const {
-  return *component_.collection_;
-}
 inline ::pb::mission::Mission_Collection* Mission_Component::release_collection() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.Component.collection)
-  if (has_collection()) {
+  if (_internal_has_collection()) {
     clear_has_component();
-      ::pb::mission::Mission_Collection* temp = component_.collection_;
-    component_.collection_ = NULL;
+    ::pb::mission::Mission_Collection* temp = _impl_.component_.collection_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.component_.collection_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::pb::mission::Mission_Collection& Mission_Component::_internal_collection() const {
+  return _internal_has_collection()
+      ? *_impl_.component_.collection_
+      : reinterpret_cast< ::pb::mission::Mission_Collection&>(::pb::mission::_Mission_Collection_default_instance_);
+}
 inline const ::pb::mission::Mission_Collection& Mission_Component::collection() const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.Component.collection)
-  return has_collection()
-      ? *component_.collection_
-      : *reinterpret_cast< ::pb::mission::Mission_Collection*>(&::pb::mission::_Mission_Collection_default_instance_);
+  return _internal_collection();
 }
-inline ::pb::mission::Mission_Collection* Mission_Component::mutable_collection() {
-  if (!has_collection()) {
+inline ::pb::mission::Mission_Collection* Mission_Component::unsafe_arena_release_collection() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:pb.mission.Mission.Component.collection)
+  if (_internal_has_collection()) {
+    clear_has_component();
+    ::pb::mission::Mission_Collection* temp = _impl_.component_.collection_;
+    _impl_.component_.collection_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Mission_Component::unsafe_arena_set_allocated_collection(::pb::mission::Mission_Collection* collection) {
+  clear_component();
+  if (collection) {
+    set_has_collection();
+    _impl_.component_.collection_ = collection;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:pb.mission.Mission.Component.collection)
+}
+inline ::pb::mission::Mission_Collection* Mission_Component::_internal_mutable_collection() {
+  if (!_internal_has_collection()) {
     clear_component();
     set_has_collection();
-    component_.collection_ = CreateMaybeMessage< ::pb::mission::Mission_Collection >(
-        GetArenaNoVirtual());
+    _impl_.component_.collection_ = CreateMaybeMessage< ::pb::mission::Mission_Collection >(GetArenaForAllocation());
   }
+  return _impl_.component_.collection_;
+}
+inline ::pb::mission::Mission_Collection* Mission_Component::mutable_collection() {
+  ::pb::mission::Mission_Collection* _msg = _internal_mutable_collection();
   // @@protoc_insertion_point(field_mutable:pb.mission.Mission.Component.collection)
-  return component_.collection_;
+  return _msg;
 }
 
 inline bool Mission_Component::has_component() const {
   return component_case() != COMPONENT_NOT_SET;
 }
 inline void Mission_Component::clear_has_component() {
-  _oneof_case_[0] = COMPONENT_NOT_SET;
+  _impl_._oneof_case_[0] = COMPONENT_NOT_SET;
 }
 inline Mission_Component::ComponentCase Mission_Component::component_case() const {
-  return Mission_Component::ComponentCase(_oneof_case_[0]);
+  return Mission_Component::ComponentCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -1753,85 +3130,600 @@ inline Mission_Component::ComponentCase Mission_Component::component_case() cons
 
 // string name = 1;
 inline void Mission::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& Mission::name() const {
+inline const std::string& Mission::name() const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void Mission::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Mission::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:pb.mission.Mission.name)
 }
-#if LANG_CXX11
-inline void Mission::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:pb.mission.Mission.name)
+inline std::string* Mission::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pb.mission.Mission.name)
+  return _s;
 }
-#endif
-inline void Mission::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:pb.mission.Mission.name)
+inline const std::string& Mission::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Mission::set_name(const char* value, size_t size) {
+inline void Mission::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:pb.mission.Mission.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Mission::mutable_name() {
+inline std::string* Mission::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:pb.mission.Mission.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Mission::release_name() {
+inline std::string* Mission::release_name() {
   // @@protoc_insertion_point(field_release:pb.mission.Mission.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void Mission::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void Mission::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:pb.mission.Mission.name)
 }
 
 // repeated .pb.mission.Mission.Component components = 2;
+inline int Mission::_internal_components_size() const {
+  return _impl_.components_.size();
+}
 inline int Mission::components_size() const {
-  return components_.size();
+  return _internal_components_size();
 }
 inline void Mission::clear_components() {
-  components_.Clear();
+  _impl_.components_.Clear();
 }
 inline ::pb::mission::Mission_Component* Mission::mutable_components(int index) {
   // @@protoc_insertion_point(field_mutable:pb.mission.Mission.components)
-  return components_.Mutable(index);
+  return _impl_.components_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::pb::mission::Mission_Component >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::Mission_Component >*
 Mission::mutable_components() {
   // @@protoc_insertion_point(field_mutable_list:pb.mission.Mission.components)
-  return &components_;
+  return &_impl_.components_;
+}
+inline const ::pb::mission::Mission_Component& Mission::_internal_components(int index) const {
+  return _impl_.components_.Get(index);
 }
 inline const ::pb::mission::Mission_Component& Mission::components(int index) const {
   // @@protoc_insertion_point(field_get:pb.mission.Mission.components)
-  return components_.Get(index);
+  return _internal_components(index);
+}
+inline ::pb::mission::Mission_Component* Mission::_internal_add_components() {
+  return _impl_.components_.Add();
 }
 inline ::pb::mission::Mission_Component* Mission::add_components() {
+  ::pb::mission::Mission_Component* _add = _internal_add_components();
   // @@protoc_insertion_point(field_add:pb.mission.Mission.components)
-  return components_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::pb::mission::Mission_Component >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::Mission_Component >&
 Mission::components() const {
   // @@protoc_insertion_point(field_list:pb.mission.Mission.components)
-  return components_;
+  return _impl_.components_;
+}
+
+// -------------------------------------------------------------------
+
+// MissionIndex_Component
+
+// uint64 offset = 1;
+inline void MissionIndex_Component::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t MissionIndex_Component::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t MissionIndex_Component::offset() const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionIndex.Component.offset)
+  return _internal_offset();
+}
+inline void MissionIndex_Component::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void MissionIndex_Component::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:pb.mission.MissionIndex.Component.offset)
+}
+
+// uint32 size = 2;
+inline void MissionIndex_Component::clear_size() {
+  _impl_.size_ = 0u;
+}
+inline uint32_t MissionIndex_Component::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint32_t MissionIndex_Component::size() const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionIndex.Component.size)
+  return _internal_size();
+}
+inline void MissionIndex_Component::_internal_set_size(uint32_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void MissionIndex_Component::set_size(uint32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:pb.mission.MissionIndex.Component.size)
+}
+
+// string name = 3;
+inline void MissionIndex_Component::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& MissionIndex_Component::name() const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionIndex.Component.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MissionIndex_Component::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pb.mission.MissionIndex.Component.name)
+}
+inline std::string* MissionIndex_Component::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pb.mission.MissionIndex.Component.name)
+  return _s;
+}
+inline const std::string& MissionIndex_Component::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MissionIndex_Component::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MissionIndex_Component::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MissionIndex_Component::release_name() {
+  // @@protoc_insertion_point(field_release:pb.mission.MissionIndex.Component.name)
+  return _impl_.name_.Release();
+}
+inline void MissionIndex_Component::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pb.mission.MissionIndex.Component.name)
+}
+
+// repeated uint64 element_offsets = 4;
+inline int MissionIndex_Component::_internal_element_offsets_size() const {
+  return _impl_.element_offsets_.size();
+}
+inline int MissionIndex_Component::element_offsets_size() const {
+  return _internal_element_offsets_size();
+}
+inline void MissionIndex_Component::clear_element_offsets() {
+  _impl_.element_offsets_.Clear();
+}
+inline uint64_t MissionIndex_Component::_internal_element_offsets(int index) const {
+  return _impl_.element_offsets_.Get(index);
+}
+inline uint64_t MissionIndex_Component::element_offsets(int index) const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionIndex.Component.element_offsets)
+  return _internal_element_offsets(index);
+}
+inline void MissionIndex_Component::set_element_offsets(int index, uint64_t value) {
+  _impl_.element_offsets_.Set(index, value);
+  // @@protoc_insertion_point(field_set:pb.mission.MissionIndex.Component.element_offsets)
+}
+inline void MissionIndex_Component::_internal_add_element_offsets(uint64_t value) {
+  _impl_.element_offsets_.Add(value);
+}
+inline void MissionIndex_Component::add_element_offsets(uint64_t value) {
+  _internal_add_element_offsets(value);
+  // @@protoc_insertion_point(field_add:pb.mission.MissionIndex.Component.element_offsets)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+MissionIndex_Component::_internal_element_offsets() const {
+  return _impl_.element_offsets_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+MissionIndex_Component::element_offsets() const {
+  // @@protoc_insertion_point(field_list:pb.mission.MissionIndex.Component.element_offsets)
+  return _internal_element_offsets();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+MissionIndex_Component::_internal_mutable_element_offsets() {
+  return &_impl_.element_offsets_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+MissionIndex_Component::mutable_element_offsets() {
+  // @@protoc_insertion_point(field_mutable_list:pb.mission.MissionIndex.Component.element_offsets)
+  return _internal_mutable_element_offsets();
+}
+
+// repeated uint32 element_sizes = 5;
+inline int MissionIndex_Component::_internal_element_sizes_size() const {
+  return _impl_.element_sizes_.size();
+}
+inline int MissionIndex_Component::element_sizes_size() const {
+  return _internal_element_sizes_size();
+}
+inline void MissionIndex_Component::clear_element_sizes() {
+  _impl_.element_sizes_.Clear();
+}
+inline uint32_t MissionIndex_Component::_internal_element_sizes(int index) const {
+  return _impl_.element_sizes_.Get(index);
+}
+inline uint32_t MissionIndex_Component::element_sizes(int index) const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionIndex.Component.element_sizes)
+  return _internal_element_sizes(index);
+}
+inline void MissionIndex_Component::set_element_sizes(int index, uint32_t value) {
+  _impl_.element_sizes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:pb.mission.MissionIndex.Component.element_sizes)
+}
+inline void MissionIndex_Component::_internal_add_element_sizes(uint32_t value) {
+  _impl_.element_sizes_.Add(value);
+}
+inline void MissionIndex_Component::add_element_sizes(uint32_t value) {
+  _internal_add_element_sizes(value);
+  // @@protoc_insertion_point(field_add:pb.mission.MissionIndex.Component.element_sizes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+MissionIndex_Component::_internal_element_sizes() const {
+  return _impl_.element_sizes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+MissionIndex_Component::element_sizes() const {
+  // @@protoc_insertion_point(field_list:pb.mission.MissionIndex.Component.element_sizes)
+  return _internal_element_sizes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+MissionIndex_Component::_internal_mutable_element_sizes() {
+  return &_impl_.element_sizes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+MissionIndex_Component::mutable_element_sizes() {
+  // @@protoc_insertion_point(field_mutable_list:pb.mission.MissionIndex.Component.element_sizes)
+  return _internal_mutable_element_sizes();
+}
+
+// -------------------------------------------------------------------
+
+// MissionIndex
+
+// repeated .pb.mission.MissionIndex.Component components = 1;
+inline int MissionIndex::_internal_components_size() const {
+  return _impl_.components_.size();
+}
+inline int MissionIndex::components_size() const {
+  return _internal_components_size();
+}
+inline void MissionIndex::clear_components() {
+  _impl_.components_.Clear();
+}
+inline ::pb::mission::MissionIndex_Component* MissionIndex::mutable_components(int index) {
+  // @@protoc_insertion_point(field_mutable:pb.mission.MissionIndex.components)
+  return _impl_.components_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::MissionIndex_Component >*
+MissionIndex::mutable_components() {
+  // @@protoc_insertion_point(field_mutable_list:pb.mission.MissionIndex.components)
+  return &_impl_.components_;
+}
+inline const ::pb::mission::MissionIndex_Component& MissionIndex::_internal_components(int index) const {
+  return _impl_.components_.Get(index);
+}
+inline const ::pb::mission::MissionIndex_Component& MissionIndex::components(int index) const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionIndex.components)
+  return _internal_components(index);
+}
+inline ::pb::mission::MissionIndex_Component* MissionIndex::_internal_add_components() {
+  return _impl_.components_.Add();
+}
+inline ::pb::mission::MissionIndex_Component* MissionIndex::add_components() {
+  ::pb::mission::MissionIndex_Component* _add = _internal_add_components();
+  // @@protoc_insertion_point(field_add:pb.mission.MissionIndex.components)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::pb::mission::MissionIndex_Component >&
+MissionIndex::components() const {
+  // @@protoc_insertion_point(field_list:pb.mission.MissionIndex.components)
+  return _impl_.components_;
+}
+
+// uint64 header_offset = 2;
+inline void MissionIndex::clear_header_offset() {
+  _impl_.header_offset_ = uint64_t{0u};
+}
+inline uint64_t MissionIndex::_internal_header_offset() const {
+  return _impl_.header_offset_;
+}
+inline uint64_t MissionIndex::header_offset() const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionIndex.header_offset)
+  return _internal_header_offset();
+}
+inline void MissionIndex::_internal_set_header_offset(uint64_t value) {
+  
+  _impl_.header_offset_ = value;
+}
+inline void MissionIndex::set_header_offset(uint64_t value) {
+  _internal_set_header_offset(value);
+  // @@protoc_insertion_point(field_set:pb.mission.MissionIndex.header_offset)
+}
+
+// uint32 header_size = 3;
+inline void MissionIndex::clear_header_size() {
+  _impl_.header_size_ = 0u;
+}
+inline uint32_t MissionIndex::_internal_header_size() const {
+  return _impl_.header_size_;
+}
+inline uint32_t MissionIndex::header_size() const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionIndex.header_size)
+  return _internal_header_size();
+}
+inline void MissionIndex::_internal_set_header_size(uint32_t value) {
+  
+  _impl_.header_size_ = value;
+}
+inline void MissionIndex::set_header_size(uint32_t value) {
+  _internal_set_header_size(value);
+  // @@protoc_insertion_point(field_set:pb.mission.MissionIndex.header_size)
+}
+
+// -------------------------------------------------------------------
+
+// MissionEdit
+
+// .pb.mission.MissionEdit.Type type = 1;
+inline void MissionEdit::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::pb::mission::MissionEdit_Type MissionEdit::_internal_type() const {
+  return static_cast< ::pb::mission::MissionEdit_Type >(_impl_.type_);
+}
+inline ::pb::mission::MissionEdit_Type MissionEdit::type() const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionEdit.type)
+  return _internal_type();
+}
+inline void MissionEdit::_internal_set_type(::pb::mission::MissionEdit_Type value) {
+  
+  _impl_.type_ = value;
+}
+inline void MissionEdit::set_type(::pb::mission::MissionEdit_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:pb.mission.MissionEdit.type)
+}
+
+// repeated uint32 parent = 2;
+inline int MissionEdit::_internal_parent_size() const {
+  return _impl_.parent_.size();
+}
+inline int MissionEdit::parent_size() const {
+  return _internal_parent_size();
+}
+inline void MissionEdit::clear_parent() {
+  _impl_.parent_.Clear();
+}
+inline uint32_t MissionEdit::_internal_parent(int index) const {
+  return _impl_.parent_.Get(index);
+}
+inline uint32_t MissionEdit::parent(int index) const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionEdit.parent)
+  return _internal_parent(index);
+}
+inline void MissionEdit::set_parent(int index, uint32_t value) {
+  _impl_.parent_.Set(index, value);
+  // @@protoc_insertion_point(field_set:pb.mission.MissionEdit.parent)
+}
+inline void MissionEdit::_internal_add_parent(uint32_t value) {
+  _impl_.parent_.Add(value);
+}
+inline void MissionEdit::add_parent(uint32_t value) {
+  _internal_add_parent(value);
+  // @@protoc_insertion_point(field_add:pb.mission.MissionEdit.parent)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+MissionEdit::_internal_parent() const {
+  return _impl_.parent_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+MissionEdit::parent() const {
+  // @@protoc_insertion_point(field_list:pb.mission.MissionEdit.parent)
+  return _internal_parent();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+MissionEdit::_internal_mutable_parent() {
+  return &_impl_.parent_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+MissionEdit::mutable_parent() {
+  // @@protoc_insertion_point(field_mutable_list:pb.mission.MissionEdit.parent)
+  return _internal_mutable_parent();
+}
+
+// uint32 row = 3;
+inline void MissionEdit::clear_row() {
+  _impl_.row_ = 0u;
+}
+inline uint32_t MissionEdit::_internal_row() const {
+  return _impl_.row_;
+}
+inline uint32_t MissionEdit::row() const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionEdit.row)
+  return _internal_row();
+}
+inline void MissionEdit::_internal_set_row(uint32_t value) {
+  
+  _impl_.row_ = value;
+}
+inline void MissionEdit::set_row(uint32_t value) {
+  _internal_set_row(value);
+  // @@protoc_insertion_point(field_set:pb.mission.MissionEdit.row)
+}
+
+// uint32 count = 4;
+inline void MissionEdit::clear_count() {
+  _impl_.count_ = 0u;
+}
+inline uint32_t MissionEdit::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint32_t MissionEdit::count() const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionEdit.count)
+  return _internal_count();
+}
+inline void MissionEdit::_internal_set_count(uint32_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void MissionEdit::set_count(uint32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:pb.mission.MissionEdit.count)
+}
+
+// string name = 5;
+inline void MissionEdit::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& MissionEdit::name() const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionEdit.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MissionEdit::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:pb.mission.MissionEdit.name)
+}
+inline std::string* MissionEdit::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:pb.mission.MissionEdit.name)
+  return _s;
+}
+inline const std::string& MissionEdit::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MissionEdit::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MissionEdit::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MissionEdit::release_name() {
+  // @@protoc_insertion_point(field_release:pb.mission.MissionEdit.name)
+  return _impl_.name_.Release();
+}
+inline void MissionEdit::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:pb.mission.MissionEdit.name)
+}
+
+// repeated bytes messages = 6;
+inline int MissionEdit::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int MissionEdit::messages_size() const {
+  return _internal_messages_size();
+}
+inline void MissionEdit::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline std::string* MissionEdit::add_messages() {
+  std::string* _s = _internal_add_messages();
+  // @@protoc_insertion_point(field_add_mutable:pb.mission.MissionEdit.messages)
+  return _s;
+}
+inline const std::string& MissionEdit::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const std::string& MissionEdit::messages(int index) const {
+  // @@protoc_insertion_point(field_get:pb.mission.MissionEdit.messages)
+  return _internal_messages(index);
+}
+inline std::string* MissionEdit::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:pb.mission.MissionEdit.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline void MissionEdit::set_messages(int index, const std::string& value) {
+  _impl_.messages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:pb.mission.MissionEdit.messages)
+}
+inline void MissionEdit::set_messages(int index, std::string&& value) {
+  _impl_.messages_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:pb.mission.MissionEdit.messages)
+}
+inline void MissionEdit::set_messages(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.messages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:pb.mission.MissionEdit.messages)
+}
+inline void MissionEdit::set_messages(int index, const void* value, size_t size) {
+  _impl_.messages_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:pb.mission.MissionEdit.messages)
+}
+inline std::string* MissionEdit::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline void MissionEdit::add_messages(const std::string& value) {
+  _impl_.messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:pb.mission.MissionEdit.messages)
+}
+inline void MissionEdit::add_messages(std::string&& value) {
+  _impl_.messages_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:pb.mission.MissionEdit.messages)
+}
+inline void MissionEdit::add_messages(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:pb.mission.MissionEdit.messages)
+}
+inline void MissionEdit::add_messages(const void* value, size_t size) {
+  _impl_.messages_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:pb.mission.MissionEdit.messages)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MissionEdit::messages() const {
+  // @@protoc_insertion_point(field_list:pb.mission.MissionEdit.messages)
+  return _impl_.messages_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MissionEdit::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:pb.mission.MissionEdit.messages)
+  return &_impl_.messages_;
 }
 
 #ifdef __GNUC__
@@ -1849,12 +3741,29 @@ Mission::components() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace mission
 }  // namespace pb
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::pb::mission::MissionEdit_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::pb::mission::MissionEdit_Type>() {
+  return ::pb::mission::MissionEdit_Type_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_mission_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_mission_2eproto
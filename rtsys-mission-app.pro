@@ -0,0 +1,21 @@
+QT += widgets
+requires(qtConfig(treeview))
+TARGET = rtsys-mission
+
+# Core
+include(core/core.pri)
+
+# Model
+HEADERS += private/model.h private/backend.h private/model_misc.h private/pool.h
+SOURCES += private/model.cpp private/backend.cpp
+
+
+# Widget
+FORMS += widget/tree.ui
+HEADERS += widget/tree.h
+SOURCES += widget/tree.cpp
+
+# Main
+HEADERS += manager.h
+SOURCES += manager.cpp main.cpp
+RESOURCES += resource.qrc
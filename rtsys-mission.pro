@@ -1,23 +1,21 @@
-QT += widgets
-requires(qtConfig(treeview))
+TEMPLATE = subdirs
 
-# Protbuf
-OTHER_FILES += protobuf/mission.proto
-HEADERS += protobuf/mission.pb.h
-SOURCES += protobuf/mission.pb.cc
-LIBS += -lprotobuf
+# Core, the headless mission library
+SUBDIRS += core
 
-# Model
-HEADERS += private/model.h private/backend.h private/model_misc.h
-SOURCES += private/model.cpp private/backend.cpp
+# App, the mission tree widget
+SUBDIRS += app
+app.file = rtsys-mission-app.pro
+app.depends = core
 
+# CLI, the batch mission processor
+SUBDIRS += cli
+cli.depends = core
 
-# Widget
-FORMS += widget/tree.ui
-HEADERS += widget/tree.h
-SOURCES += widget/tree.cpp
+# Bench, the benchmarks of the model hot paths
+SUBDIRS += bench
+bench.depends = core
 
-# Main
-HEADERS += manager.h
-SOURCES += manager.cpp main.cpp
-RESOURCES += resource.qrc
+# Tests, the unit tests of the core
+SUBDIRS += tests
+tests.depends = core
@@ -0,0 +1,46 @@
+#ifndef RTSYS_MISSION_FIXTURE_H
+#define RTSYS_MISSION_FIXTURE_H
+
+// ===
+// === Include
+// ============================================================================ //
+
+#include "protobuf/mission.pb.h"
+
+#include <QString>
+#include <QStringList>
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns a mission of top-level points of the given names.
+inline pb::mission::Mission missionOf(const QStringList &names)
+{
+    pb::mission::Mission mission;
+    for (const auto &name : names) {
+        mission.add_components()->mutable_element()->mutable_point()->set_name(name.toStdString());
+    }
+    return mission;
+}
+
+// Appends a collection of points of the given names to the given mission.
+inline void addCollection(pb::mission::Mission *mission, const QString &name, const QStringList &names)
+{
+    auto *collection = mission->add_components()->mutable_collection();
+    collection->set_name(name.toStdString());
+    for (const auto &point : names) {
+        collection->add_elements()->mutable_point()->set_name(point.toStdString());
+    }
+}
+
+// Appends a rail of the given names to the given mission.
+inline void addRail(pb::mission::Mission *mission, const QString &name, const QString &p0, const QString &p1)
+{
+    auto *rail = mission->add_components()->mutable_element()->mutable_rail();
+    rail->set_name(name.toStdString());
+    rail->mutable_p0()->set_name(p0.toStdString());
+    rail->mutable_p1()->set_name(p1.toStdString());
+}
+
+#endif // RTSYS_MISSION_FIXTURE_H
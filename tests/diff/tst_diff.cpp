@@ -0,0 +1,192 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/diff.h"
+#include "tests/common/mission_fixture.h"
+
+#include <QtTest>
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns the edits turning the first given mission into the second one, as
+// text (see mission::describe).
+static QStringList describe(const pb::mission::Mission &from, const pb::mission::Mission &to)
+{
+    return mission::describe(mission::diff(from, to));
+}
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines the tests of the structural diff of missions (see core/diff.h).
+class TestDiff : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void identical();
+    void hashes();
+    void renameMission();
+    void insertRows();
+    void removeRows();
+    void shiftRows();
+    void moveRow();
+    void moveRows();
+    void renameRow();
+    void changeRail();
+    void changeType();
+    void collectionElements();
+    void editOrder();
+};
+
+// An unchanged mission has no edit.
+void TestDiff::identical()
+{
+    auto mission = missionOf({"A", "B", "C"});
+    addCollection(&mission, "K", {"k1", "k2"});
+    QVERIFY(mission::diff(mission, mission).isEmpty());
+    QVERIFY(mission::diff(pb::mission::Mission(), pb::mission::Mission()).isEmpty());
+}
+
+// Equal subtrees have the same hash, a name or a point changes it.
+void TestDiff::hashes()
+{
+    auto mission = missionOf({"A", "A", "B"});
+    addRail(&mission, "R", "R0", "R1");
+    addRail(&mission, "R", "R0", "R2");
+    addCollection(&mission, "K", {"k1", "k2"});
+    addCollection(&mission, "K", {"k2", "k1"});
+    const auto &components = mission.components();
+    QCOMPARE(mission::hashOf(components.Get(0)), mission::hashOf(components.Get(1)));
+    QVERIFY(mission::hashOf(components.Get(0)) != mission::hashOf(components.Get(2)));
+    QVERIFY(mission::hashOf(components.Get(3)) != mission::hashOf(components.Get(4)));
+    QVERIFY(mission::hashOf(components.Get(5)) != mission::hashOf(components.Get(6)));
+    QCOMPARE(mission::hashOf(components.Get(0)), mission::hashOf(components.Get(0).element()));
+}
+
+// The name of the mission is an edit of the mission itself.
+void TestDiff::renameMission()
+{
+    auto from = missionOf({"A"});
+    auto to = from;
+    to.set_name("renamed");
+    QCOMPARE(describe(from, to), QStringList({"rename mission -> mission \"renamed\""}));
+}
+
+// Consecutive rows inserted together make a single edit.
+void TestDiff::insertRows()
+{
+    QCOMPARE(describe(missionOf({"A", "B", "C"}), missionOf({"A", "X", "Y", "B", "C"})),
+             QStringList({"insert 1, 2 rows"}));
+    QCOMPARE(describe(missionOf({"A", "B"}), missionOf({"A", "X", "B", "Y"})),
+             QStringList({"insert 1", "insert 3"}));
+}
+
+// Consecutive rows removed together make a single edit.
+void TestDiff::removeRows()
+{
+    QCOMPARE(describe(missionOf({"A", "B", "C", "D"}), missionOf({"A", "D"})), QStringList({"remove 1, 2 rows"}));
+    QCOMPARE(describe(missionOf({"A", "B", "C"}), pb::mission::Mission()), QStringList({"remove 0, 3 rows"}));
+}
+
+// The rows after more rows inserted than looked up ahead are still matched.
+void TestDiff::shiftRows()
+{
+    QStringList names;
+    for (int i = 0; i < 100; i++) {
+        names.append(QString("P%1").arg(i));
+    }
+    QStringList inserted;
+    for (int i = 0; i < 40; i++) {
+        inserted.append(QString("X%1").arg(i));
+    }
+    QCOMPARE(describe(missionOf(names), missionOf(inserted + names)), QStringList({"insert 0, 40 rows"}));
+    QCOMPARE(describe(missionOf(inserted + names), missionOf(names)), QStringList({"remove 0, 40 rows"}));
+}
+
+// A row taken out of the order is moved, the longest sequence of rows in order
+// stays in place.
+void TestDiff::moveRow()
+{
+    QCOMPARE(describe(missionOf({"A", "B", "C", "D", "E"}), missionOf({"B", "C", "D", "E", "A"})),
+             QStringList({"move 0 -> 4"}));
+    QCOMPARE(describe(missionOf({"A", "B", "C", "D", "E"}), missionOf({"A", "D", "B", "C", "E"})),
+             QStringList({"move 3 -> 1"}));
+}
+
+// Consecutive rows moved together make a single edit.
+void TestDiff::moveRows()
+{
+    QCOMPARE(describe(missionOf({"A", "B", "C", "D", "E", "F"}), missionOf({"D", "E", "A", "B", "C", "F"})),
+             QStringList({"move 3 -> 0, 2 rows"}));
+}
+
+// A row whose name only changed is renamed in place, not removed then
+// inserted.
+void TestDiff::renameRow()
+{
+    QCOMPARE(describe(missionOf({"A", "B", "C"}), missionOf({"A", "B2", "C"})),
+             QStringList({"rename 1 -> 1 \"B2\""}));
+}
+
+// A rail whose points changed is changed, as it keeps its name. A rail both
+// renamed and changed is another rail.
+void TestDiff::changeRail()
+{
+    pb::mission::Mission from;
+    addRail(&from, "R", "R0", "R1");
+    auto to = from;
+    to.mutable_components(0)->mutable_element()->mutable_rail()->mutable_p1()->set_name("R1b");
+    QCOMPARE(describe(from, to), QStringList({"change 0 -> 0"}));
+
+    to.mutable_components(0)->mutable_element()->mutable_rail()->set_name("S");
+    QCOMPARE(describe(from, to), QStringList({"remove 0", "insert 0"}));
+}
+
+// A row of another type is never matched, it is removed then inserted.
+void TestDiff::changeType()
+{
+    pb::mission::Mission to;
+    addRail(&to, "A", "A0", "A1");
+    QCOMPARE(describe(missionOf({"A"}), to), QStringList({"remove 0", "insert 0"}));
+}
+
+// The elements of a changed collection are diffed on their own, their paths
+// are given under the collection.
+void TestDiff::collectionElements()
+{
+    pb::mission::Mission from;
+    addCollection(&from, "K", {"k1", "k2", "k3"});
+    pb::mission::Mission to;
+    addCollection(&to, "L", {"k1", "k3", "k4"});
+    QCOMPARE(describe(from, to), QStringList({"rename 0 -> 0 \"L\"", "remove 0/1", "insert 0/2"}));
+
+    pb::mission::Mission moved;
+    addCollection(&moved, "K", {"k3", "k1", "k2"});
+    QCOMPARE(describe(from, moved), QStringList({"move 0/2 -> 0/0"}));
+}
+
+// The edits are ordered per level: the removals, the insertions and the moves
+// of the components come first, then the renames and the changes of each
+// component in turn, the edits of the elements of a collection coming right
+// after its own rename.
+void TestDiff::editOrder()
+{
+    pb::mission::Mission from = missionOf({"A"});
+    addCollection(&from, "K", {"k1", "k2"});
+    addCollection(&from, "M", {"m1"});
+    pb::mission::Mission to;
+    addCollection(&to, "K2", {"k1", "k2", "k3"});
+    addCollection(&to, "M", {});
+    to.add_components()->mutable_element()->mutable_point()->set_name("C");
+
+    QCOMPARE(describe(from, to), QStringList({"remove 0", "insert 2", "rename 1 -> 0 \"K2\"", "insert 0/2",
+                                              "remove 2/0"}));
+}
+
+QTEST_APPLESS_MAIN(TestDiff)
+#include "tst_diff.moc"
@@ -0,0 +1,261 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/diff.h"
+#include "core/file.h"
+#include "core/generator.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QtTest>
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The size of the trailer ending a streaming mission file: the offset, the
+// size and the CRC-32 of the index, then the magic (see file::StreamReader).
+const int TrailerSize = 20;
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns a generated mission of the given number of components.
+static pb::mission::Mission generated(int components)
+{
+    mission::GeneratorOptions options;
+    options.components = components;
+    options.elements = 50;
+    options.seed = 1;
+    pb::mission::Mission mission;
+    mission::generate(options, &mission);
+    return mission;
+}
+
+// Changes the component of the given row of the given mission into a point of
+// the given name.
+static void changeComponent(pb::mission::Mission *mission, int row, const QString &name)
+{
+    mission->mutable_components(row)->mutable_element()->mutable_point()->set_name(name.toStdString());
+}
+
+// Returns the entries of a mission of the given number of components for the
+// file it was last saved to (see file::saveStream): each component is the
+// record of its row, but the given rows which changed since.
+static QVector<int> entriesOf(int count, const QVector<int> &changed)
+{
+    QVector<int> entries;
+    for (int row = 0; row < count; row++) {
+        entries.append(changed.contains(row) ? -1 : row);
+    }
+    return entries;
+}
+
+// Returns the content of the file specified by the given path.
+static QByteArray readAll(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) return QByteArray();
+    return file.readAll();
+}
+
+// Replaces the content of the file specified by the given path.
+static bool writeAll(const QString &path, const QByteArray &data)
+{
+    QFile file(path);
+    return file.open(QIODevice::WriteOnly | QIODevice::Truncate) && file.write(data) == data.size();
+}
+
+// Returns a trailer giving the index at the given offset, of the given size
+// and checksum.
+static QByteArray trailerOf(quint64 offset, quint32 size, quint32 checksum)
+{
+    QByteArray trailer;
+    for (int i = 0; i < 8; i++) trailer.append(static_cast<char>(offset >> (8 * i)));
+    for (int i = 0; i < 4; i++) trailer.append(static_cast<char>(size >> (8 * i)));
+    for (int i = 0; i < 4; i++) trailer.append(static_cast<char>(checksum >> (8 * i)));
+    trailer.append("RTSI", 4);
+    return trailer;
+}
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines the tests of the streaming mission files (see core/file.h).
+class TestFile : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void truncatedTrailer();
+    void badChecksum();
+    void outOfRangeIndex();
+    void appendSaves();
+    void compactSave();
+    void interruptedAppend();
+
+  private:
+    QTemporaryDir _dir;
+};
+
+// A file whose trailer is cut off is rejected, it isn't read as a plain
+// mission file either.
+void TestFile::truncatedTrailer()
+{
+    const auto &path = _dir.filePath("truncated.rtsm");
+    QVERIFY(file::writeStream(path, generated(20)));
+    auto data = readAll(path);
+    data.chop(3);
+    QVERIFY(writeAll(path, data));
+
+    file::StreamReader reader(path);
+    QVERIFY(!reader.open());
+    QVERIFY(reader.hasError());
+    pb::mission::Mission mission;
+    QVERIFY(!file::load(path, &mission));
+}
+
+// A file saved whole whose index doesn't match its checksum is still read,
+// its records in sequence.
+void TestFile::badChecksum()
+{
+    const auto &path = _dir.filePath("checksum.rtsm");
+    const auto &mission = generated(20);
+    QVERIFY(file::writeStream(path, mission));
+    auto data = readAll(path);
+    data[data.size() - 8] = static_cast<char>(data.at(data.size() - 8) ^ 1);
+    QVERIFY(writeAll(path, data));
+
+    file::StreamReader reader(path);
+    QVERIFY(reader.open());
+    QVERIFY(!reader.hasIndex());
+    pb::mission::Mission loaded;
+    QVERIFY(file::load(path, &loaded));
+    QVERIFY(mission::diff(mission, loaded).isEmpty());
+}
+
+// A trailer whose index lies out of the file is rejected, whether its offset
+// wraps around once added to its size or its size exceeds the file.
+void TestFile::outOfRangeIndex()
+{
+    const auto &path = _dir.filePath("range.rtsm");
+    QVERIFY(file::writeStream(path, generated(20)));
+    const auto &data = readAll(path);
+    const auto &records = data.left(data.size() - TrailerSize);
+    const auto &end = static_cast<quint64>(records.size());
+
+    const QVector<QPair<quint64, quint64>> ranges = {
+        {0 - quint64(4096), end + 4096}, {0, end}, {8, end}, {end - 4, 0xFFFFFFFF}};
+    for (const auto &range : ranges) {
+        QVERIFY(writeAll(path, records + trailerOf(range.first, static_cast<quint32>(range.second), 0)));
+        file::StreamReader reader(path);
+        QVERIFY(!reader.open());
+        QVERIFY(reader.hasError());
+    }
+}
+
+// The changed components are appended to the file saved last, the file being
+// reopened after each save, and the unchanged records are referenced where
+// they are, whatever the rows of their components.
+void TestFile::appendSaves()
+{
+    const auto &path = _dir.filePath("append.rtsm");
+    auto mission = generated(20);
+    QVERIFY(file::writeStream(path, mission));
+
+    for (int save = 0; save < 2; save++) {
+        const auto &data = readAll(path);
+        file::StreamReader reader(path);
+        QVERIFY(reader.open());
+        QVERIFY(reader.hasIndex());
+
+        auto entries = entriesOf(mission.components_size(), {save});
+        changeComponent(&mission, save, QString("changed %1").arg(save));
+        if (save == 1) {
+            mission.mutable_components()->DeleteSubrange(5, 2);
+            entries.remove(5, 2);
+        }
+        QVERIFY(file::saveStream(path, mission, entries, &reader));
+
+        const auto &saved = readAll(path);
+        QVERIFY(saved.size() > data.size());
+        QVERIFY(saved.left(data.size()) == data);
+        pb::mission::Mission loaded;
+        QVERIFY(file::load(path, &loaded));
+        QVERIFY(mission::diff(mission, loaded).isEmpty());
+    }
+}
+
+// The file is compacted, rewritten whole, once it would hold more bytes no
+// longer referenced than records still referenced.
+void TestFile::compactSave()
+{
+    const auto &path = _dir.filePath("compact.rtsm");
+    auto mission = generated(20);
+    QVERIFY(file::writeStream(path, mission));
+    {
+        file::StreamReader reader(path);
+        QVERIFY(reader.open());
+        QVector<int> changed;
+        for (int row = 0; row < 15; row++) {
+            changeComponent(&mission, row, QString("changed %1").arg(row));
+            changed.append(row);
+        }
+        QVERIFY(file::saveStream(path, mission, entriesOf(mission.components_size(), changed), &reader));
+    }
+
+    const auto &whole_path = _dir.filePath("whole.rtsm");
+    QVERIFY(file::writeStream(whole_path, mission));
+    QCOMPARE(readAll(path).size(), readAll(whole_path).size());
+    pb::mission::Mission loaded;
+    QVERIFY(file::load(path, &loaded));
+    QVERIFY(mission::diff(mission, loaded).isEmpty());
+}
+
+// A file whose last save was cut off, anywhere in the appended records or its
+// trailer, reads as the previous save. The next save appends after the
+// damaged end.
+void TestFile::interruptedAppend()
+{
+    const auto &path = _dir.filePath("interrupted.rtsm");
+    const auto &previous = generated(20);
+    QVERIFY(file::writeStream(path, previous));
+    const auto &data = readAll(path);
+
+    auto mission = previous;
+    changeComponent(&mission, 0, "changed");
+    {
+        file::StreamReader reader(path);
+        QVERIFY(reader.open());
+        QVERIFY(file::saveStream(path, mission, entriesOf(mission.components_size(), {0}), &reader));
+    }
+    const auto &appended = readAll(path);
+    QVERIFY(appended.size() > data.size());
+
+    for (const auto &size : {data.size() + (appended.size() - data.size()) / 2, appended.size() - 2}) {
+        QVERIFY(writeAll(path, appended.left(size)));
+        file::StreamReader reader(path);
+        QVERIFY(reader.open());
+        QVERIFY(reader.hasIndex());
+        QCOMPARE(reader.validSize(), qint64(data.size()));
+        pb::mission::Mission loaded;
+        QVERIFY(file::load(path, &loaded));
+        QVERIFY(mission::diff(previous, loaded).isEmpty());
+    }
+
+    {
+        file::StreamReader reader(path);
+        QVERIFY(reader.open());
+        QVERIFY(file::saveStream(path, mission, entriesOf(mission.components_size(), {0}), &reader));
+    }
+    QVERIFY(readAll(path).size() > appended.size() - 2);
+    pb::mission::Mission loaded;
+    QVERIFY(file::load(path, &loaded));
+    QVERIFY(mission::diff(mission, loaded).isEmpty());
+}
+
+QTEST_APPLESS_MAIN(TestFile)
+#include "tst_file.moc"
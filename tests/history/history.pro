@@ -0,0 +1,11 @@
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+TARGET = tst_history
+
+# Core
+include(../../core/core.pri)
+
+# Main
+HEADERS += ../common/mission_fixture.h
+SOURCES += tst_history.cpp
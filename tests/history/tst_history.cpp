@@ -0,0 +1,223 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/history.h"
+#include "core/mission.h"
+#include "tests/common/mission_fixture.h"
+
+#include <QtTest>
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns the names of the top-level points of the given mission.
+static QStringList namesOf(const pb::mission::Mission &mission)
+{
+    QStringList names;
+    for (const auto &component : mission.components()) {
+        names.append(QString::fromStdString(component.element().point().name()));
+    }
+    return names;
+}
+
+// Inserts a point of the given name at the given row of the given mission and
+// records the change into the given history.
+static void insertPoint(pb::mission::Mission *mission, MissionHistory *history, int row, const QString &name)
+{
+    const auto &point = missionOf({name});
+    mission::insert(mission, mission::kMission, row, mission::serialize(&point, mission::kMission, 0, 1));
+    history->record({MissionHistory::Change::kInsert, {}, row, 1, {}});
+}
+
+// Removes the given rows of the given mission and records the change into the
+// given history, with the rows removed.
+static void removeRows(pb::mission::Mission *mission, MissionHistory *history, int row, int count)
+{
+    const auto &removed = mission::serialize(mission, mission::kMission, row, count);
+    mission::remove(mission, mission::kMission, row, count);
+    history->record({MissionHistory::Change::kRemove, {}, row, count, removed});
+}
+
+// Makes the given change again on the given mission, or reverts it when undone,
+// the way the manager does (see MissionManager::applyChange).
+static bool applyChange(pb::mission::Mission *mission, MissionHistory::Change *change, bool is_undone)
+{
+    const auto &is_inserted = (change->type == MissionHistory::Change::kInsert) != is_undone;
+    if (is_inserted) {
+        if (!mission::insert(mission, mission::kMission, change->row, change->messages)) return false;
+        change->messages.clear();
+        return true;
+    }
+    change->messages = mission::serialize(mission, mission::kMission, change->row, change->count);
+    return mission::remove(mission, mission::kMission, change->row, change->count);
+}
+
+// Undoes the last step of the given history on the given mission.
+static bool undo(pb::mission::Mission *mission, MissionHistory *history)
+{
+    if (!history->canUndo()) return false;
+
+    auto step = history->takeUndo();
+    for (int i = step.count() - 1; i >= 0; i--) {
+        if (!applyChange(mission, &step[i], true)) return false;
+    }
+    history->pushRedo(step);
+    return true;
+}
+
+// Redoes the last step undone of the given history on the given mission.
+static bool redo(pb::mission::Mission *mission, MissionHistory *history)
+{
+    if (!history->canRedo()) return false;
+
+    auto step = history->takeRedo();
+    for (int i = 0; i < step.count(); i++) {
+        if (!applyChange(mission, &step[i], false)) return false;
+    }
+    history->pushUndo(step);
+    return true;
+}
+
+// Returns the mission of the points P0 to P9, with the points of the given
+// rows removed one by one into the given history, each one making its own
+// step. The budget of the history is set to the size of the given number of
+// these steps once the first one is recorded.
+static pb::mission::Mission removedMission(MissionHistory *history, const QVector<int> &rows, int steps)
+{
+    auto mission = missionOf({"P0", "P1", "P2", "P3", "P4", "P5", "P6", "P7", "P8", "P9"});
+    for (const auto &row : rows) {
+        removeRows(&mission, history, row, 1);
+        if (history->undoCount() == 1) history->setBudget(steps * history->size());
+    }
+    return mission;
+}
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines the tests of the history of the mission edits (see
+// core/history.h).
+class TestHistory : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void coalesceInserts();
+    void coalesceRemoves();
+    void evictionOrder();
+    void undoRedoAfterEviction();
+};
+
+// The points inserted within or right after the points inserted before are
+// undone and redone at once, a point inserted elsewhere makes another step.
+void TestHistory::coalesceInserts()
+{
+    MissionHistory history;
+    auto mission = missionOf({"P0", "P1", "P2"});
+    insertPoint(&mission, &history, 3, "A");
+    insertPoint(&mission, &history, 4, "B");
+    insertPoint(&mission, &history, 3, "C");
+    QCOMPARE(history.undoCount(), 1);
+    insertPoint(&mission, &history, 0, "D");
+    QCOMPARE(history.undoCount(), 2);
+    QCOMPARE(namesOf(mission), QStringList({"D", "P0", "P1", "P2", "C", "A", "B"}));
+
+    QVERIFY(undo(&mission, &history));
+    QCOMPARE(namesOf(mission), QStringList({"P0", "P1", "P2", "C", "A", "B"}));
+    QVERIFY(undo(&mission, &history));
+    QCOMPARE(namesOf(mission), QStringList({"P0", "P1", "P2"}));
+    QVERIFY(!history.canUndo());
+
+    QVERIFY(redo(&mission, &history));
+    QCOMPARE(namesOf(mission), QStringList({"P0", "P1", "P2", "C", "A", "B"}));
+    QVERIFY(redo(&mission, &history));
+    QCOMPARE(namesOf(mission), QStringList({"D", "P0", "P1", "P2", "C", "A", "B"}));
+    QVERIFY(!history.canRedo());
+}
+
+// The points removed backward then forward from the same row are undone at
+// once and come back in order, the changes grouped into a step aren't
+// coalesced with the next one.
+void TestHistory::coalesceRemoves()
+{
+    MissionHistory history;
+    auto mission = missionOf({"P0", "P1", "P2", "P3", "P4", "P5"});
+    removeRows(&mission, &history, 4, 1);
+    removeRows(&mission, &history, 3, 1);
+    removeRows(&mission, &history, 2, 1);
+    removeRows(&mission, &history, 2, 1);
+    QCOMPARE(history.undoCount(), 1);
+    QCOMPARE(namesOf(mission), QStringList({"P0", "P1"}));
+
+    QVERIFY(undo(&mission, &history));
+    QCOMPARE(namesOf(mission), QStringList({"P0", "P1", "P2", "P3", "P4", "P5"}));
+
+    history.beginStep();
+    removeRows(&mission, &history, 0, 1);
+    history.endStep();
+    removeRows(&mission, &history, 0, 1);
+    QCOMPARE(history.undoCount(), 2);
+    QCOMPARE(history.redoCount(), 0);
+    QVERIFY(undo(&mission, &history));
+    QCOMPARE(namesOf(mission), QStringList({"P1", "P2", "P3", "P4", "P5"}));
+}
+
+// The history is kept under its budget by evicting the oldest steps done
+// first, then the steps undone the farthest from the current mission.
+void TestHistory::evictionOrder()
+{
+    MissionHistory history;
+    auto mission = removedMission(&history, {8, 6, 4, 2, 0}, 3);
+    QCOMPARE(history.undoCount(), 3);
+    QVERIFY(history.size() <= history.budget());
+
+    // The removals of P0 and P2 are undone, the removal of P4 is still done.
+    QVERIFY(undo(&mission, &history));
+    QVERIFY(undo(&mission, &history));
+    QCOMPARE(history.undoCount(), 1);
+    QCOMPARE(history.redoCount(), 2);
+
+    history.setBudget(history.size() - 1);
+    QCOMPARE(history.undoCount(), 0);
+    QCOMPARE(history.redoCount(), 2);
+    history.setBudget(history.size() - 1);
+    QCOMPARE(history.redoCount(), 1);
+
+    // The removal of P2, the next step to redo, is kept.
+    QVERIFY(redo(&mission, &history));
+    QCOMPARE(namesOf(mission), QStringList({"P0", "P1", "P3", "P5", "P7", "P9"}));
+    history.setBudget(0);
+    QCOMPARE(history.undoCount(), 0);
+    QCOMPARE(history.redoCount(), 0);
+    QCOMPARE(history.size(), 0);
+}
+
+// The steps left after an eviction are undone down to the oldest step kept,
+// then redone and undone again as before.
+void TestHistory::undoRedoAfterEviction()
+{
+    MissionHistory history;
+    auto mission = removedMission(&history, {8, 6, 4, 2, 0}, 3);
+    while (history.canUndo()) {
+        QVERIFY(undo(&mission, &history));
+    }
+    QCOMPARE(history.redoCount(), 3);
+    QCOMPARE(namesOf(mission), QStringList({"P0", "P1", "P2", "P3", "P4", "P5", "P7", "P9"}));
+
+    while (history.canRedo()) {
+        QVERIFY(redo(&mission, &history));
+    }
+    QCOMPARE(history.undoCount(), 3);
+    QCOMPARE(namesOf(mission), QStringList({"P1", "P3", "P5", "P7", "P9"}));
+
+    while (history.canUndo()) {
+        QVERIFY(undo(&mission, &history));
+    }
+    QCOMPARE(namesOf(mission), QStringList({"P0", "P1", "P2", "P3", "P4", "P5", "P7", "P9"}));
+}
+
+QTEST_APPLESS_MAIN(TestHistory)
+#include "tst_history.moc"
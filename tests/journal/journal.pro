@@ -0,0 +1,10 @@
+QT = core testlib
+CONFIG += console testcase
+CONFIG -= app_bundle
+TARGET = tst_journal
+
+# Core
+include(../../core/core.pri)
+
+# Main
+SOURCES += tst_journal.cpp
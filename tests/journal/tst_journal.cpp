@@ -0,0 +1,149 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/journal.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QtTest>
+
+// ===
+// === Define
+// ============================================================================ //
+
+// The identity of the mission file the journals apply to, its valid size and
+// the checksum of its index.
+const qint64 FileSize = 4096;
+const quint32 FileChecksum = 0x12345678;
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns the edit adding a point of the given name at the given row of the
+// mission.
+static pb::mission::MissionEdit editOf(int row, const QString &name)
+{
+    pb::mission::MissionEdit edit;
+    edit.set_type(pb::mission::MissionEdit::kAddPoint);
+    edit.set_row(row);
+    edit.set_count(1);
+    edit.set_name(name.toStdString());
+    return edit;
+}
+
+// Returns the names of the given edits.
+static QStringList namesOf(const QVector<pb::mission::MissionEdit> &edits)
+{
+    QStringList names;
+    for (const auto &edit : edits) {
+        names.append(QString::fromStdString(edit.name()));
+    }
+    return names;
+}
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines the tests of the journal of the mission edits (see
+// core/journal.h).
+class TestJournal : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void replay();
+    void tornRecord();
+    void otherFile();
+
+  private:
+    QStringList replayed(const QString &path);
+
+    QTemporaryDir _dir;
+};
+
+// Returns the names of the edits replayed from the journal specified by the
+// given path, for the mission file of the tests. The journal is closed again.
+QStringList TestJournal::replayed(const QString &path)
+{
+    MissionJournal journal;
+    QVector<pb::mission::MissionEdit> edits;
+    if (!journal.open(path, FileSize, FileChecksum, &edits)) return {"not opened"};
+    return namesOf(edits);
+}
+
+// The edits are replayed in order, and the edits appended after a replay
+// follow them.
+void TestJournal::replay()
+{
+    const auto &path = _dir.filePath("replay.journal");
+    MissionJournal journal;
+    QVERIFY(journal.open(path, FileSize, FileChecksum));
+    journal.append(editOf(0, "A"));
+    journal.append(editOf(1, "B"));
+    journal.close();
+    QCOMPARE(replayed(path), QStringList({"A", "B"}));
+
+    QVector<pb::mission::MissionEdit> edits;
+    QVERIFY(journal.open(path, FileSize, FileChecksum, &edits));
+    QCOMPARE(edits.count(), 2);
+    QCOMPARE(edits.at(1).row(), quint32(1));
+    journal.append(editOf(2, "C"));
+    journal.close();
+    QCOMPARE(replayed(path), QStringList({"A", "B", "C"}));
+}
+
+// A record torn by a crash is dropped along with the end of the journal, the
+// next edits are appended after the last valid record.
+void TestJournal::tornRecord()
+{
+    const auto &path = _dir.filePath("torn.journal");
+    MissionJournal journal;
+    QVERIFY(journal.open(path, FileSize, FileChecksum));
+    journal.append(editOf(0, "A"));
+    journal.append(editOf(1, "B"));
+    journal.append(editOf(2, "C"));
+    journal.close();
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.resize(file.size() - 2));
+    file.close();
+
+    QVector<pb::mission::MissionEdit> edits;
+    QVERIFY(journal.open(path, FileSize, FileChecksum, &edits));
+    QCOMPARE(namesOf(edits), QStringList({"A", "B"}));
+    journal.append(editOf(2, "D"));
+    journal.close();
+    QCOMPARE(replayed(path), QStringList({"A", "B", "D"}));
+}
+
+// A journal of another mission file, or of another save of the file, is
+// discarded: nothing is replayed and the journal starts over.
+void TestJournal::otherFile()
+{
+    const auto &path = _dir.filePath("other.journal");
+    MissionJournal journal;
+    QVERIFY(journal.open(path, FileSize, FileChecksum));
+    journal.append(editOf(0, "A"));
+    journal.close();
+
+    QVector<pb::mission::MissionEdit> edits;
+    QVERIFY(journal.open(path, FileSize, FileChecksum + 1, &edits));
+    QVERIFY(edits.isEmpty());
+    journal.close();
+    QVERIFY(replayed(path).isEmpty());
+
+    QVERIFY(journal.open(path, FileSize, FileChecksum));
+    journal.append(editOf(0, "A"));
+    journal.close();
+    QVERIFY(journal.open(path, FileSize + 1, FileChecksum, &edits));
+    QVERIFY(edits.isEmpty());
+    journal.close();
+    QVERIFY(replayed(path).isEmpty());
+}
+
+QTEST_APPLESS_MAIN(TestJournal)
+#include "tst_journal.moc"
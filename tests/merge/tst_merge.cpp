@@ -0,0 +1,222 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/merge.h"
+#include "tests/common/mission_fixture.h"
+
+#include <QtTest>
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns the names of the components of the given mission: the name of a
+// point, the names of a rail and its points, or the names of a collection and
+// its points.
+static QStringList namesOf(const pb::mission::Mission &mission)
+{
+    QStringList names;
+    for (const auto &component : mission.components()) {
+        if (component.has_collection()) {
+            QStringList elements;
+            for (const auto &element : component.collection().elements()) {
+                elements.append(QString::fromStdString(element.point().name()));
+            }
+            names.append(QString("%1(%2)").arg(QString::fromStdString(component.collection().name()),
+                                               elements.join(' ')));
+        } else if (component.element().has_rail()) {
+            const auto &rail = component.element().rail();
+            names.append(QString("%1(%2 %3)").arg(QString::fromStdString(rail.name()),
+                                                  QString::fromStdString(rail.p0().name()),
+                                                  QString::fromStdString(rail.p1().name())));
+        } else {
+            names.append(QString::fromStdString(component.element().point().name()));
+        }
+    }
+    return names;
+}
+
+// Merges theirs into ours, given their base, and returns the conflicts as text
+// (see mission::describe).
+static QStringList merge(const pb::mission::Mission &base, const pb::mission::Mission &theirs,
+                         pb::mission::Mission *ours)
+{
+    return mission::describe(mission::merge(base, theirs, ours));
+}
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines the tests of the three-way merge of missions (see
+// core/merge.h).
+class TestMerge : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void unchanged();
+    void renameMission();
+    void changeFields();
+    void changeConflicts();
+    void removeRows();
+    void removeConflicts();
+    void insertRows();
+    void moveRow();
+    void moveConflicts();
+    void insertAfterMovedRow();
+    void collectionElements();
+};
+
+// Ours is kept as is when theirs didn't change the base.
+void TestMerge::unchanged()
+{
+    const auto &base = missionOf({"A", "B", "C"});
+    auto ours = missionOf({"C", "X", "A"});
+    QVERIFY(merge(base, base, &ours).isEmpty());
+    QCOMPARE(namesOf(ours), QStringList({"C", "X", "A"}));
+}
+
+// The name of the mission changed by theirs only is taken, ours is kept when
+// both changed it.
+void TestMerge::renameMission()
+{
+    const auto &base = missionOf({"A"});
+    auto theirs = base;
+    theirs.set_name("theirs");
+    auto ours = base;
+    QVERIFY(merge(base, theirs, &ours).isEmpty());
+    QCOMPARE(ours.name(), std::string("theirs"));
+
+    ours.set_name("ours");
+    QCOMPARE(merge(base, theirs, &ours), QStringList({"both changed the name of the mission"}));
+    QCOMPARE(ours.name(), std::string("ours"));
+}
+
+// The fields of a row changed by one side each are all merged.
+void TestMerge::changeFields()
+{
+    pb::mission::Mission base;
+    addRail(&base, "R", "R0", "R1");
+    auto theirs = base;
+    theirs.mutable_components(0)->mutable_element()->mutable_rail()->mutable_p1()->set_name("T1");
+    auto ours = base;
+    ours.mutable_components(0)->mutable_element()->mutable_rail()->set_name("S");
+    QVERIFY(merge(base, theirs, &ours).isEmpty());
+    QCOMPARE(namesOf(ours), QStringList({"S(R0 T1)"}));
+}
+
+// A field changed differently by both is a conflict, ours is kept.
+void TestMerge::changeConflicts()
+{
+    const auto &base = missionOf({"A", "B", "C"});
+    auto ours = missionOf({"A", "B1", "C"});
+    QCOMPARE(merge(base, missionOf({"A", "B2", "C"}), &ours),
+             QStringList({"both changed the name of base 1 (ours 1, theirs 1)"}));
+    QCOMPARE(namesOf(ours), QStringList({"A", "B1", "C"}));
+
+    ours = base;
+    QVERIFY(merge(base, missionOf({"A", "B2", "C"}), &ours).isEmpty());
+    QCOMPARE(namesOf(ours), QStringList({"A", "B2", "C"}));
+}
+
+// The rows removed by theirs are removed from ours, wherever ours moved them.
+void TestMerge::removeRows()
+{
+    const auto &base = missionOf({"A", "B", "C", "D"});
+    auto ours = missionOf({"C", "A", "X", "B", "D"});
+    QVERIFY(merge(base, missionOf({"A", "D"}), &ours).isEmpty());
+    QCOMPARE(namesOf(ours), QStringList({"A", "X", "D"}));
+}
+
+// A row removed by one side and changed by the other is a conflict, ours is
+// kept.
+void TestMerge::removeConflicts()
+{
+    const auto &base = missionOf({"A", "B", "C"});
+    auto ours = missionOf({"A", "B1", "C"});
+    QCOMPARE(merge(base, missionOf({"A", "C"}), &ours),
+             QStringList({"removed and changed base 1 (ours 1, theirs -)"}));
+    QCOMPARE(namesOf(ours), QStringList({"A", "B1", "C"}));
+
+    ours = missionOf({"A", "C"});
+    QCOMPARE(merge(base, missionOf({"A", "B2", "C"}), &ours),
+             QStringList({"removed and changed base 1 (ours -, theirs 1)"}));
+    QCOMPARE(namesOf(ours), QStringList({"A", "C"}));
+}
+
+// The rows inserted by theirs follow the rows ours inserted at the same place,
+// the rows inserted by both at the same place are only kept once.
+void TestMerge::insertRows()
+{
+    const auto &base = missionOf({"A", "B"});
+    auto ours = missionOf({"X", "A", "Y", "B"});
+    QVERIFY(merge(base, missionOf({"A", "Z", "B", "W"}), &ours).isEmpty());
+    QCOMPARE(namesOf(ours), QStringList({"X", "A", "Y", "Z", "B", "W"}));
+
+    ours = missionOf({"A", "Y", "B"});
+    QVERIFY(merge(base, missionOf({"A", "Y", "B"}), &ours).isEmpty());
+    QCOMPARE(namesOf(ours), QStringList({"A", "Y", "B"}));
+}
+
+// A row moved by theirs only is moved after the row it follows in theirs, and
+// the rows moved by both to the same place aren't a conflict.
+void TestMerge::moveRow()
+{
+    const auto &base = missionOf({"A", "B", "C", "D"});
+    auto ours = missionOf({"A", "B", "X", "C", "D"});
+    QVERIFY(merge(base, missionOf({"B", "C", "D", "A"}), &ours).isEmpty());
+    QCOMPARE(namesOf(ours), QStringList({"B", "X", "C", "D", "A"}));
+
+    ours = missionOf({"B", "C", "D", "A"});
+    QVERIFY(merge(base, missionOf({"B", "C", "D", "A"}), &ours).isEmpty());
+    QCOMPARE(namesOf(ours), QStringList({"B", "C", "D", "A"}));
+}
+
+// A row moved by both to different places is a conflict, ours is kept.
+void TestMerge::moveConflicts()
+{
+    const auto &base = missionOf({"A", "B", "C", "D"});
+    auto ours = missionOf({"B", "C", "D", "A"});
+    QCOMPARE(merge(base, missionOf({"B", "C", "A", "D"}), &ours),
+             QStringList({"both moved base 0 (ours 3, theirs 2)"}));
+    QCOMPARE(namesOf(ours), QStringList({"B", "C", "D", "A"}));
+}
+
+// The rows theirs inserted after a row it moved follow the row to its new
+// place, with the rows ours inserted after it.
+void TestMerge::insertAfterMovedRow()
+{
+    const auto &base = missionOf({"A", "B", "C", "D"});
+    const auto &theirs = missionOf({"B", "C", "A", "X", "D"});
+    auto ours = base;
+    QVERIFY(merge(base, theirs, &ours).isEmpty());
+    QCOMPARE(namesOf(ours), QStringList({"B", "C", "A", "X", "D"}));
+
+    ours = missionOf({"A", "Y", "B", "C", "D"});
+    QVERIFY(merge(base, theirs, &ours).isEmpty());
+    QCOMPARE(namesOf(ours), QStringList({"B", "C", "A", "Y", "X", "D"}));
+
+    ours = missionOf({"A", "X", "B", "C", "D"});
+    QVERIFY(merge(base, theirs, &ours).isEmpty());
+    QCOMPARE(namesOf(ours), QStringList({"B", "C", "A", "X", "D"}));
+}
+
+// The elements of a collection are merged on their own, their conflicts are
+// given under the collection.
+void TestMerge::collectionElements()
+{
+    auto base = missionOf({"A"});
+    addCollection(&base, "K", {"k1", "k2", "k3"});
+    auto theirs = missionOf({"A"});
+    addCollection(&theirs, "K", {"k1", "t2", "k3", "t4"});
+    auto ours = missionOf({"A"});
+    addCollection(&ours, "L", {"k1", "o2", "k3"});
+    QCOMPARE(merge(base, theirs, &ours),
+             QStringList({"both changed the name of base 1/1 (ours 1/1, theirs 1/1)"}));
+    QCOMPARE(namesOf(ours), QStringList({"A", "L(k1 o2 k3 t4)"}));
+}
+
+QTEST_APPLESS_MAIN(TestMerge)
+#include "tst_merge.moc"
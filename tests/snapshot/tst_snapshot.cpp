@@ -0,0 +1,151 @@
+// ===
+// === Include
+// ============================================================================ //
+
+#include "core/diff.h"
+#include "core/generator.h"
+#include "core/mission.h"
+#include "core/snapshot.h"
+#include "tests/common/mission_fixture.h"
+
+#include <QSet>
+#include <QtTest>
+
+// ===
+// === Function
+// ============================================================================ //
+
+// Returns a generated mission allocated on the given arena, as the snapshots
+// require, ended with a collection of many points. Both the components and
+// the elements of the last collection span many chunks.
+static pb::mission::Mission *generated(google::protobuf::Arena *arena)
+{
+    mission::GeneratorOptions options;
+    options.components = 8000;
+    options.elements = 10;
+    options.seed = 1;
+    auto *mission = google::protobuf::Arena::CreateMessage<pb::mission::Mission>(arena);
+    mission::generate(options, mission);
+
+    QStringList names;
+    for (int i = 0; i < 8000; i++) {
+        names.append(QString("E%1").arg(i));
+    }
+    addCollection(mission, "K", names);
+    return mission;
+}
+
+// Edits the given mission the way the manager does, telling the given builder
+// which collection changed: the components 10 to 12 are removed, 2 elements
+// are removed from the last collection and another one is inserted into it,
+// then a point is appended to the mission.
+static void edit(pb::mission::Mission *mission, MissionSnapshotBuilder *builder)
+{
+    mission::remove(mission, mission::kMission, 10, 3);
+    auto *collection = mission->mutable_components(mission->components_size() - 1)->mutable_collection();
+    mission::remove(collection, mission::kCollection, 5, 2);
+    const auto &messages = mission::serialize(collection, mission::kCollection, 0, 1);
+    mission::insert(collection, mission::kCollection, 4000, messages);
+    builder->touch(collection);
+    mission::addPoint(mission, mission::kMission)->set_name("Added");
+}
+
+// Returns the number of chunks of the second given list shared with the first
+// one.
+template <class T>
+static int sharedChunkCount(const SharedList<T> &first, const SharedList<T> &second)
+{
+    QSet<const void *> chunks;
+    for (int i = 0; i < first.chunkCount(); i++) {
+        chunks.insert(&first.chunk(i));
+    }
+    auto count = 0;
+    for (int i = 0; i < second.chunkCount(); i++) {
+        if (chunks.contains(&second.chunk(i))) count++;
+    }
+    return count;
+}
+
+// ===
+// === Class
+// ============================================================================ //
+
+// This defines the tests of the snapshots of a mission (see core/snapshot.h).
+class TestSnapshot : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void unchanged();
+    void copyOnWrite();
+    void restore();
+};
+
+// The snapshot of an unchanged mission shares all the chunks of the last one.
+void TestSnapshot::unchanged()
+{
+    google::protobuf::Arena arena;
+    auto *mission = generated(&arena);
+    MissionSnapshotBuilder builder;
+    const auto &first = builder.take(*mission);
+    const auto &second = builder.take(*mission);
+    QCOMPARE(second.components().count(), mission->components_size());
+    QCOMPARE(sharedChunkCount(first.components(), second.components()), first.components().chunkCount());
+}
+
+// The snapshot of an edited mission shares the components which didn't change
+// with the last one, and the chunks away from the edits. The collection which
+// changed is copied, its chunks away from the edits are shared as well.
+void TestSnapshot::copyOnWrite()
+{
+    google::protobuf::Arena arena;
+    auto *mission = generated(&arena);
+    MissionSnapshotBuilder builder;
+    const auto &first = builder.take(*mission);
+    edit(mission, &builder);
+    const auto &second = builder.take(*mission);
+
+    const auto &components = first.components();
+    const auto &last = components.count() - 1;
+    QCOMPARE(second.components().count(), components.count() - 2);
+    QVERIFY(components.chunkCount() > 8);
+    QVERIFY(sharedChunkCount(components, second.components()) >= components.chunkCount() - 5);
+
+    auto copied = 0;
+    for (int i = 0; i < last; i++) {
+        if (i >= 10 && i < 13) continue;
+        if (&components.at(i) != &second.components().at(i < 10 ? i : i - 3)) copied++;
+    }
+    QCOMPARE(copied, 0);
+
+    const auto &collection = components.at(last);
+    const auto &changed = second.components().at(last - 3);
+    QVERIFY(&collection != &changed);
+    QCOMPARE(changed.elements.count(), collection.elements.count() - 1);
+    QVERIFY(collection.elements.chunkCount() > 8);
+    QVERIFY(sharedChunkCount(collection.elements, changed.elements) >= collection.elements.chunkCount() - 5);
+}
+
+// Restoring a snapshot after later edits gives back the exact mission it was
+// taken of, and the later snapshot the edited mission.
+void TestSnapshot::restore()
+{
+    google::protobuf::Arena arena;
+    auto *mission = generated(&arena);
+    const pb::mission::Mission original(*mission);
+    MissionSnapshotBuilder builder;
+    const auto &snapshot = builder.take(*mission);
+    edit(mission, &builder);
+    const auto &edited = builder.take(*mission);
+    QVERIFY(!mission::diff(original, *mission).isEmpty());
+
+    pb::mission::Mission restored;
+    snapshot.copyTo(&restored);
+    QVERIFY(mission::diff(original, restored).isEmpty());
+    QCOMPARE(restored.SerializeAsString(), original.SerializeAsString());
+    edited.copyTo(&restored);
+    QVERIFY(mission::diff(*mission, restored).isEmpty());
+}
+
+QTEST_APPLESS_MAIN(TestSnapshot)
+#include "tst_snapshot.moc"
@@ -0,0 +1,9 @@
+TEMPLATE = subdirs
+
+# The tests of the headless mission library, run by 'make check'
+SUBDIRS += diff
+SUBDIRS += merge
+SUBDIRS += file
+SUBDIRS += journal
+SUBDIRS += history
+SUBDIRS += snapshot
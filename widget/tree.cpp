@@ -29,9 +29,38 @@ MissionTreeWidget::MissionTreeWidget(QWidget *parent)
 
     // connect(ui->actionNewMission, &QAction::triggered, &manager, &MissionManager::addMission);
     // connect(ui->actionNewMission, &QAction::triggered, this, [&]() { _manager.addMission(_index); });
-    connect(ui->actionDelete, &QAction::triggered, this, [&]() { _manager.remove(_index); });
+    connect(ui->actionDelete, &QAction::triggered, this, [&]() {
+        // Deleting a selected item deletes the whole selection at once.
+        auto *selection = ui->treeView->selectionModel();
+        if (selection->isSelected(_index))
+            _manager.remove(selection->selectedIndexes());
+        else
+            _manager.remove(_index);
+    });
     connect(ui->actionAddPoint, &QAction::triggered, this, [&]() { _manager.addPoint(_index); });
     connect(ui->actionAddRail, &QAction::triggered, this, [&]() { _manager.addRail(_index); });
+
+    // The edits are undone and redone with the standard shortcuts.
+    ui->actionUndo->setShortcut(QKeySequence::Undo);
+    ui->actionRedo->setShortcut(QKeySequence::Redo);
+    addAction(ui->actionUndo);
+    addAction(ui->actionRedo);
+    connect(ui->actionUndo, &QAction::triggered, this, [&]() { _manager.undo(); });
+    connect(ui->actionRedo, &QAction::triggered, this, [&]() { _manager.redo(); });
+
+    // The manager refuses the edits while a mission is loading, their actions
+    // are disabled meanwhile.
+    connect(&_manager, &MissionManager::loadStarted, this, [this]() { setEditEnabled(false); });
+    connect(&_manager, &MissionManager::loadFinished, this, [this]() { setEditEnabled(true); });
+
+    // The missions are loaded in the background, the mission is expanded once
+    // its item is inserted.
+    connect(_manager.model(), &QAbstractItemModel::rowsInserted, this,
+            [this](const QModelIndex &parent, int first) {
+                if (parent.isValid()) return;
+                ui->treeView->expand(_manager.model()->index(first, 0));
+                ui->treeView->resizeColumnToContents(0);
+            });
 }
 
 MissionTreeWidget::~MissionTreeWidget()
@@ -39,11 +68,22 @@ MissionTreeWidget::~MissionTreeWidget()
     delete ui;
 }
 
-void MissionTreeWidget::loadMission(pb::mission::Mission *mission)
+void MissionTreeWidget::loadMission(std::unique_ptr<pb::mission::Mission> mission)
 {
-    _manager.loadMission(mission);
-    ui->treeView->expandAll();
-    ui->treeView->resizeColumnToContents(0);
+    _manager.loadMission(std::move(mission));
+}
+
+void MissionTreeWidget::openFile(const QString &path)
+{
+    _manager.openFile(path);
+}
+
+void MissionTreeWidget::setEditEnabled(bool is_enabled)
+{
+    for (auto *action : {ui->actionDelete, ui->actionAddPoint, ui->actionAddRail, ui->actionAddSegment,
+                         ui->actionAddCollection, ui->actionUndo, ui->actionRedo}) {
+        action->setEnabled(is_enabled);
+    }
 }
 
 void MissionTreeWidget::createCustomContexMenu(const QPoint &position)
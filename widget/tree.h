@@ -17,9 +17,12 @@ class MissionTreeWidget : public QWidget
     explicit MissionTreeWidget(QWidget *parent = nullptr);
     ~MissionTreeWidget();
 
-    void loadMission(pb::mission::Mission *mission);
+    void loadMission(std::unique_ptr<pb::mission::Mission> mission);
+    void openFile(const QString &path);
+    MissionManager &manager() { return _manager; }
 
   private:
+    void setEditEnabled(bool is_enabled);
     void createCustomContexMenu(const QPoint &position);
     Ui::MissionTreeWidget *ui;
     MissionManager _manager;